@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+
+namespace Core {
+
+// Notifies its owner when the system starts to run low on memory, so that caches which can be rebuilt on demand may
+// be dropped. The notification fires once each time the system enters such a state.
+class MemoryPressureWatcher {
+    AK_MAKE_NONCOPYABLE(MemoryPressureWatcher);
+
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> create();
+    virtual ~MemoryPressureWatcher() = default;
+
+    Function<void()> on_memory_pressure;
+
+protected:
+    MemoryPressureWatcher() = default;
+};
+
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/File.h>
+#include <LibCore/MemoryPressureWatcher.h>
+#include <LibCore/Timer.h>
+#include <stdio.h>
+
+namespace Core {
+
+// https://docs.kernel.org/accounting/psi.html
+static constexpr auto pressure_stall_file = "/proc/pressure/memory"sv;
+
+static constexpr int polling_interval_ms = 2000;
+
+// The share of the last 10 seconds in which some task was stalled waiting for memory, above which the system is
+// considered to be under memory pressure.
+static constexpr float memory_pressure_threshold_percentage = 10.0f;
+
+class MemoryPressureWatcherImpl final : public MemoryPressureWatcher {
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcherImpl>> create()
+    {
+        auto file = TRY(File::open(pressure_stall_file, File::OpenMode::Read));
+        (void)TRY(read_stall_percentage(*file));
+
+        return adopt_own(*new MemoryPressureWatcherImpl(move(file)));
+    }
+
+private:
+    explicit MemoryPressureWatcherImpl(NonnullOwnPtr<File> file)
+        : m_file(move(file))
+    {
+        m_timer = Timer::create_repeating(polling_interval_ms, [this] {
+            auto stall_percentage = read_stall_percentage(*m_file);
+            if (stall_percentage.is_error())
+                return;
+
+            auto is_under_pressure = stall_percentage.value() >= memory_pressure_threshold_percentage;
+            if (is_under_pressure && !m_was_under_pressure && on_memory_pressure)
+                on_memory_pressure();
+            m_was_under_pressure = is_under_pressure;
+        });
+        m_timer->start();
+    }
+
+    static ErrorOr<float> read_stall_percentage(File& file)
+    {
+        TRY(file.seek(0, SeekMode::SetPosition));
+
+        char buf[256] = {};
+        auto buffer = Bytes { buf, sizeof(buf) - 1 };
+        auto line = TRY(file.read_some(buffer));
+
+        float stall_percentage = 0;
+        if (sscanf(reinterpret_cast<char const*>(line.data()), "some avg10=%f", &stall_percentage) != 1)
+            return Error::from_string_literal("Failed to parse /proc/pressure/memory");
+        return stall_percentage;
+    }
+
+    NonnullOwnPtr<File> m_file;
+    RefPtr<Timer> m_timer;
+    bool m_was_under_pressure { false };
+};
+
+ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> MemoryPressureWatcher::create()
+{
+    return MemoryPressureWatcherImpl::create();
+}
+
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <LibDevTools/Actors/ProfilerActor.h>
+#include <LibDevTools/Actors/TabActor.h>
+#include <LibDevTools/DevToolsDelegate.h>
+#include <LibDevTools/DevToolsServer.h>
+
+namespace DevTools {
+
+// NB: The JS sampling profiler in WebContent cannot sample more often than once per millisecond.
+static constexpr auto DEFAULT_SAMPLING_INTERVAL = AK::Duration::from_milliseconds(1);
+
+NonnullRefPtr<ProfilerActor> ProfilerActor::create(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab)
+{
+    return adopt_ref(*new ProfilerActor(devtools, move(name), move(tab)));
+}
+
+ProfilerActor::ProfilerActor(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab)
+    : Actor(devtools, move(name))
+    , m_tab(move(tab))
+{
+}
+
+ProfilerActor::~ProfilerActor()
+{
+    if (!m_active)
+        return;
+
+    if (auto tab = m_tab.strong_ref())
+        devtools().delegate().stop_js_profiler(tab->description(), [](auto) { });
+}
+
+void ProfilerActor::handle_message(Message const& message)
+{
+    JsonObject response;
+
+    if (message.type == "isSupportedPlatform"sv) {
+        response.set("value"sv, true);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "isActive"sv) {
+        response.set("value"sv, m_active);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "startProfiler"sv) {
+        auto sampling_interval = DEFAULT_SAMPLING_INTERVAL;
+
+        if (auto options = message.data.get_object("options"sv); options.has_value()) {
+            if (auto interval = options->get_double_with_precision_loss("interval"sv); interval.has_value() && *interval >= 1)
+                sampling_interval = AK::Duration::from_milliseconds(static_cast<i64>(*interval));
+        }
+
+        if (auto tab = m_tab.strong_ref()) {
+            devtools().delegate().start_js_profiler(tab->description(), sampling_interval);
+            m_active = true;
+        }
+
+        response.set("value"sv, m_active);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "stopProfilerAndDiscardProfile"sv) {
+        if (auto tab = m_tab.strong_ref(); tab && m_active)
+            devtools().delegate().stop_js_profiler(tab->description(), [](auto) { });
+        m_active = false;
+
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "getProfileAndStopProfiler"sv) {
+        if (auto tab = m_tab.strong_ref(); tab && m_active) {
+            m_active = false;
+
+            // NB: WebContent hands back the profile in the Gecko profile format, which is what the Firefox Profiler expects here.
+            devtools().delegate().stop_js_profiler(tab->description(),
+                async_handler(message, [](auto&, auto profile, auto& response) {
+                    response.set("profile"sv, move(profile));
+                }));
+            return;
+        }
+
+        response.set("profile"sv, JsonValue {});
+        send_response(message, move(response));
+        return;
+    }
+
+    send_unrecognized_packet_type_error(message);
+}
+
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibDevTools/Actor.h>
+
+namespace DevTools {
+
+class DEVTOOLS_API ProfilerActor final : public Actor {
+public:
+    static constexpr auto base_name = "profiler"sv;
+
+    static NonnullRefPtr<ProfilerActor> create(DevToolsServer&, String name, WeakPtr<TabActor>);
+    virtual ~ProfilerActor() override;
+
+private:
+    ProfilerActor(DevToolsServer&, String name, WeakPtr<TabActor>);
+
+    virtual void handle_message(Message const&) override;
+
+    WeakPtr<TabActor> m_tab;
+    bool m_active { false };
+};
+
+}
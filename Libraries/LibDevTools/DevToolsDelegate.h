@@ -80,6 +80,10 @@ public:
     virtual void listen_for_console_messages(TabDescription const&, OnConsoleMessage) const { }
     virtual void stop_listening_for_console_messages(TabDescription const&) const { }
 
+    using OnJSProfileReceived = Function<void(ErrorOr<JsonValue>)>;
+    virtual void start_js_profiler(TabDescription const&, AK::Duration) const { }
+    virtual void stop_js_profiler(TabDescription const&, OnJSProfileReceived) const { }
+
     struct NetworkRequestData {
         u64 request_id { 0 };
         String url;
@@ -31,6 +31,7 @@ class PageStyleActor;
 class ParentAccessibilityActor;
 class PreferenceActor;
 class ProcessActor;
+class ProfilerActor;
 class RootActor;
 class StyleSheetsActor;
 class TabActor;
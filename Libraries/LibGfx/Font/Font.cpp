@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16String.h>
 #include <LibGfx/Font/Font.h>
@@ -148,10 +149,47 @@ Font::ShapingCache::~ShapingCache()
     clear();
 }
 
+hb_buffer_t* Font::ShapingCache::find(Utf16View const& text, Direction direction)
+{
+    auto it = map.find(Key::hash(text, direction), [&](auto& candidate) {
+        return candidate.key.direction == direction && candidate.key.text == text;
+    });
+    if (it == map.end())
+        return nullptr;
+    it->value.last_use = ++use_counter;
+    return it->value.buffer;
+}
+
+void Font::ShapingCache::set(Utf16View const& text, Direction direction, hb_buffer_t* buffer)
+{
+    if (map.size() >= MAXIMUM_ENTRY_COUNT)
+        evict_least_recently_used_entries();
+    map.set({ Utf16String::from_utf16(text), direction }, { buffer, ++use_counter });
+}
+
+void Font::ShapingCache::evict_least_recently_used_entries()
+{
+    // Evicting half of the entries at a time keeps the amortized cost of an insertion constant, without having to
+    // maintain a recency list on every lookup.
+    Vector<u64> last_uses;
+    last_uses.ensure_capacity(map.size());
+    for (auto const& it : map)
+        last_uses.unchecked_append(it.value.last_use);
+    quick_sort(last_uses);
+    auto threshold = last_uses[last_uses.size() / 2];
+
+    map.remove_all_matching([&](auto const&, auto const& entry) {
+        if (entry.last_use >= threshold)
+            return false;
+        hb_buffer_destroy(entry.buffer);
+        return true;
+    });
+}
+
 void Font::ShapingCache::clear()
 {
     for (auto& it : map) {
-        hb_buffer_destroy(it.value);
+        hb_buffer_destroy(it.value.buffer);
     }
     map.clear();
     for (auto& buffer : single_ascii_character_map) {
@@ -85,12 +85,45 @@ public:
     hb_font_t* harfbuzz_font() const;
     ShapeFeatures const& features() const { return m_shape_features; }
 
+    // Shaped HarfBuzz buffers for text that has been laid out with this font. Since a Font is specific to a typeface,
+    // size and set of features, the text and its direction are all that is needed to identify an entry.
     struct ShapingCache {
-        HashMap<Utf16String, hb_buffer_t*> map;
+        enum class Direction : u8 {
+            Auto,
+            Ltr,
+            Rtl,
+        };
+
+        struct Key {
+            Utf16String text;
+            Direction direction { Direction::Auto };
+
+            bool operator==(Key const&) const = default;
+
+            static u32 hash(Utf16View const& text, Direction direction) { return pair_int_hash(text.hash(), to_underlying(direction)); }
+            u32 hash() const { return hash(text, direction); }
+        };
+
+        struct Entry {
+            hb_buffer_t* buffer { nullptr };
+            u64 last_use { 0 };
+        };
+
+        // Once this many entries have been cached, the least recently used half of them is evicted.
+        static constexpr size_t MAXIMUM_ENTRY_COUNT = 4096;
+
+        hb_buffer_t* find(Utf16View const&, Direction);
+        void set(Utf16View const&, Direction, hb_buffer_t*);
+
+        HashMap<Key, Entry> map;
         hb_buffer_t* single_ascii_character_map[128] { nullptr };
+        u64 use_counter { 0 };
 
         ~ShapingCache();
         void clear();
+
+    private:
+        void evict_least_recently_used_entries();
     };
     ShapingCache& shaping_cache() const { return m_shaping_cache; }
 
@@ -117,3 +150,11 @@ private:
 };
 
 }
+
+template<>
+struct AK::Traits<Gfx::Font::ShapingCache::Key> : public AK::DefaultTraits<Gfx::Font::ShapingCache::Key> {
+    static unsigned hash(Gfx::Font::ShapingCache::Key const& key)
+    {
+        return key.hash();
+    }
+};
@@ -7,6 +7,7 @@
 
 #include <AK/FlyString.h>
 #include <LibCore/StandardPaths.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/TypefaceSkia.h>
@@ -69,6 +70,25 @@ RefPtr<Gfx::Font> FontDatabase::get_font_for_code_point(u32 code_point, float po
     return nullptr;
 }
 
+ErrorOr<NonnullRefPtr<Typeface const>> FontDatabase::get_or_decode_web_font(ReadonlyBytes bytes, Optional<String> const& partition, WebFontDecoder const& decode)
+{
+    if (!partition.has_value())
+        return decode(bytes);
+
+    WebFontKey key { .partition = *partition };
+    auto digest = Crypto::Hash::SHA256::hash(bytes.data(), bytes.size());
+    digest.bytes().copy_to(key.digest.span());
+
+    if (auto it = m_web_font_cache.find(key); it != m_web_font_cache.end())
+        return it->value;
+
+    auto typeface = TRY(decode(bytes));
+    if (m_web_font_cache.size() >= MAXIMUM_CACHED_WEB_FONT_COUNT)
+        m_web_font_cache.remove(m_web_font_cache.begin());
+    m_web_font_cache.set(key, typeface);
+    return typeface;
+}
+
 void FontDatabase::for_each_typeface_with_family_name(FlyString const& family_name, Function<void(Typeface const&)> callback)
 {
     m_system_font_provider->for_each_typeface_with_family_name(family_name, move(callback));
@@ -6,11 +6,15 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/FlyString.h>
 #include <AK/Function.h>
 #include <AK/HashFunctions.h>
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
+#include <AK/String.h>
 #include <LibGfx/Font/Typeface.h>
 #include <LibGfx/Forward.h>
 
@@ -32,6 +36,18 @@ struct CodePointFallbackKey {
     }
 };
 
+struct WebFontKey {
+    String partition;
+    Array<u8, 32> digest {};
+
+    bool operator==(WebFontKey const&) const = default;
+
+    unsigned hash() const
+    {
+        return pair_int_hash(partition.hash(), string_hash(reinterpret_cast<char const*>(digest.data()), digest.size()));
+    }
+};
+
 class SystemFontProvider {
 public:
     virtual ~SystemFontProvider();
@@ -51,6 +67,13 @@ public:
     void for_each_typeface_with_family_name(FlyString const& family_name, Function<void(Typeface const&)>);
     [[nodiscard]] StringView system_font_provider_name() const;
 
+    // Web fonts are identified by a digest of their encoded contents, so that documents loading the same font file
+    // share a single decoded Typeface (and the fonts and shaping caches hanging off it) instead of decoding it again.
+    // Like the HTTP cache, the cache is partitioned (by the caller's top-level site), so that one site can't observe
+    // which fonts another has loaded. Without a partition, the font is decoded without being cached.
+    using WebFontDecoder = Function<ErrorOr<NonnullRefPtr<Typeface const>>(ReadonlyBytes)>;
+    ErrorOr<NonnullRefPtr<Typeface const>> get_or_decode_web_font(ReadonlyBytes, Optional<String> const& partition, WebFontDecoder const&);
+
     static ErrorOr<Vector<String>> font_directories();
 
 private:
@@ -64,10 +87,24 @@ private:
         RefPtr<Typeface const> typeface;
     };
     HashMap<CodePointFallbackKey, CodePointFallbackEntry> m_code_point_fallback_cache;
+
+    // Once this many web fonts have been cached, the oldest one is dropped from the cache. Documents that still use it
+    // keep their own reference to it.
+    static constexpr size_t MAXIMUM_CACHED_WEB_FONT_COUNT = 64;
+
+    OrderedHashMap<WebFontKey, NonnullRefPtr<Typeface const>> m_web_font_cache;
 };
 
 }
 
+template<>
+struct AK::Traits<Gfx::WebFontKey> : public AK::DefaultTraits<Gfx::WebFontKey> {
+    static unsigned hash(Gfx::WebFontKey const& key)
+    {
+        return key.hash();
+    }
+};
+
 template<>
 struct AK::Traits<Gfx::CodePointFallbackKey> : public AK::DefaultTraits<Gfx::CodePointFallbackKey> {
     static unsigned hash(Gfx::CodePointFallbackKey const& key)
@@ -297,19 +297,25 @@ static sk_sp<SkColorSpace> color_space_from_cicp(Media::CodingIndependentCodePoi
     return SkColorSpace::MakeRGB(transfer_function, gamut);
 }
 
-bool ImmutableBitmap::ensure_sk_image(SkiaBackendContext& context) const
+bool ImmutableBitmap::ensure_sk_image(SkiaBackendContext* context) const
 {
+    if (!context) {
+        if (m_impl->sk_image)
+            return true;
+        return ensure_sk_image_from_yuv_on_cpu();
+    }
+
     if (m_impl->context) {
-        VERIFY(m_impl->context.ptr() == &context);
+        VERIFY(m_impl->context.ptr() == context);
         return true;
     }
 
-    context.lock();
-    ScopeGuard unlock_guard = [&context] {
-        context.unlock();
+    context->lock();
+    ScopeGuard unlock_guard = [context] {
+        context->unlock();
     };
 
-    auto* gr_context = context.sk_context();
+    auto* gr_context = context->sk_context();
 
     // Bitmap-backed: try to upload raster image to GPU texture
     if (m_impl->sk_image) {
@@ -317,17 +323,17 @@ bool ImmutableBitmap::ensure_sk_image(SkiaBackendContext& context) const
             return true; // No GPU, but raster image is still usable
         auto gpu_image = SkImages::TextureFromImage(gr_context, m_impl->sk_image.get(), skgpu::Mipmapped::kNo, skgpu::Budgeted::kYes);
         if (gpu_image) {
-            m_impl->context = context;
+            m_impl->context = *context;
             m_impl->sk_image = move(gpu_image);
         }
         return true;
     }
 
-    // YUV-backed: GPU is required to decode YUV to RGB
+    // YUV-backed: let the GPU convert to RGB if we have one
     VERIFY(m_impl->yuv_data);
 
     if (!gr_context)
-        return false; // No GPU, cannot create image from YUV data
+        return ensure_sk_image_from_yuv_on_cpu();
 
     auto const& pixmaps = m_impl->yuv_data->skia_yuva_pixmaps();
     auto color_space = color_space_from_cicp(m_impl->yuv_data->cicp());
@@ -342,11 +348,32 @@ bool ImmutableBitmap::ensure_sk_image(SkiaBackendContext& context) const
     if (!sk_image)
         return false;
 
-    m_impl->context = context;
+    m_impl->context = *context;
     m_impl->sk_image = move(sk_image);
     return true;
 }
 
+bool ImmutableBitmap::ensure_sk_image_from_yuv_on_cpu() const
+{
+    VERIFY(m_impl->yuv_data);
+    VERIFY(!m_impl->sk_image);
+
+    auto bitmap_or_error = m_impl->yuv_data->to_bitmap();
+    if (bitmap_or_error.is_error())
+        return false;
+    auto bitmap = bitmap_or_error.release_value();
+
+    SkBitmap sk_bitmap;
+    auto info = SkImageInfo::Make(bitmap->width(), bitmap->height(), to_skia_color_type(bitmap->format()), kOpaque_SkAlphaType, color_space_from_cicp(m_impl->yuv_data->cicp()));
+    sk_bitmap.installPixels(info, bitmap->scanline(0), bitmap->pitch());
+    sk_bitmap.setImmutable();
+
+    m_impl->sk_image = sk_bitmap.asImage();
+    m_impl->sk_bitmap = move(sk_bitmap);
+    m_impl->bitmap = move(bitmap);
+    return true;
+}
+
 Color ImmutableBitmap::get_pixel(int x, int y) const
 {
     return m_impl->bitmap->get_pixel(x, y);
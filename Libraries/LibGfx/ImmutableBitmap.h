@@ -57,7 +57,8 @@ public:
     ~ImmutableBitmap();
 
     bool is_yuv_backed() const;
-    bool ensure_sk_image(SkiaBackendContext&) const;
+    // Makes sure sk_image() is usable with the given context. Without a GPU, YUV-backed bitmaps are converted on the CPU.
+    bool ensure_sk_image(SkiaBackendContext*) const;
 
     int width() const;
     int height() const;
@@ -71,7 +72,7 @@ public:
 
     Color get_pixel(int x, int y) const;
 
-    // Returns nullptr for YUV-backed bitmaps
+    // Returns nullptr for YUV-backed bitmaps, unless they have been converted on the CPU
     RefPtr<Bitmap const> bitmap() const;
 
 private:
@@ -81,6 +82,8 @@ private:
 
     explicit ImmutableBitmap(NonnullOwnPtr<ImmutableBitmapImpl> bitmap);
 
+    bool ensure_sk_image_from_yuv_on_cpu() const;
+
     void lock_context();
     void unlock_context();
 };
@@ -155,14 +155,14 @@ PaintingSurface::~PaintingSurface()
     unlock_context();
 }
 
-void PaintingSurface::read_into_bitmap(Bitmap& bitmap)
+void PaintingSurface::read_into_bitmap(Bitmap& bitmap, IntPoint source_position)
 {
     lock_context();
     auto color_type = to_skia_color_type(bitmap.format());
     auto alpha_type = to_skia_alpha_type(bitmap.format(), bitmap.alpha_type());
     auto image_info = SkImageInfo::Make(bitmap.width(), bitmap.height(), color_type, alpha_type, SkColorSpace::MakeSRGB());
     SkPixmap const pixmap(image_info, bitmap.begin(), bitmap.pitch());
-    m_impl->surface->readPixels(pixmap, 0, 0);
+    m_impl->surface->readPixels(pixmap, source_position.x(), source_position.y());
     unlock_context();
 }
 
@@ -177,6 +177,21 @@ void PaintingSurface::write_from_bitmap(Bitmap const& bitmap)
     unlock_context();
 }
 
+void PaintingSurface::write_from_bitmap(Bitmap const& bitmap, IntRect const& source_rect, IntPoint destination_position)
+{
+    VERIFY(bitmap.rect().contains(source_rect));
+    if (source_rect.is_empty())
+        return;
+
+    lock_context();
+    auto color_type = to_skia_color_type(bitmap.format());
+    auto alpha_type = to_skia_alpha_type(bitmap.format(), bitmap.alpha_type());
+    auto image_info = SkImageInfo::Make(source_rect.width(), source_rect.height(), color_type, alpha_type, SkColorSpace::MakeSRGB());
+    SkPixmap const pixmap(image_info, bitmap.scanline(source_rect.y()) + source_rect.x(), bitmap.pitch());
+    m_impl->surface->writePixels(pixmap, destination_position.x(), destination_position.y());
+    unlock_context();
+}
+
 IntSize PaintingSurface::size() const
 {
     return m_impl->size;
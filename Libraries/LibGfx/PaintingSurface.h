@@ -11,6 +11,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/RefPtr.h>
 #include <LibGfx/Color.h>
+#include <LibGfx/Rect.h>
 #include <LibGfx/Size.h>
 #include <LibGfx/SkiaBackendContext.h>
 
@@ -43,8 +44,11 @@ public:
     static NonnullRefPtr<PaintingSurface> create_from_vkimage(NonnullRefPtr<SkiaBackendContext> context, NonnullRefPtr<VulkanImage> vulkan_image, Origin origin);
 #endif
 
-    void read_into_bitmap(Bitmap&);
+    // Reads the bitmap's size worth of pixels starting at source_position. Pixels outside of the surface are left untouched.
+    void read_into_bitmap(Bitmap&, IntPoint source_position = {});
     void write_from_bitmap(Bitmap const&);
+    // Replaces the pixels at destination_position with the source_rect of the bitmap, ignoring any canvas state.
+    void write_from_bitmap(Bitmap const&, IntRect const& source_rect, IntPoint destination_position);
 
     void notify_content_will_change();
 
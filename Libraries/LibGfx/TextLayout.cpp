@@ -177,34 +177,46 @@ static hb_buffer_t* setup_text_shaping(Utf16View const& string, Font const& font
     return buffer;
 }
 
-NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type)
+static Font::ShapingCache::Direction shaping_direction(Utf16View const& string, GlyphRun::TextType text_type)
+{
+    // ASCII text is always shaped left-to-right, regardless of the requested text type.
+    if (string.has_ascii_storage())
+        return Font::ShapingCache::Direction::Auto;
+    if (text_type == GlyphRun::TextType::Ltr)
+        return Font::ShapingCache::Direction::Ltr;
+    if (text_type == GlyphRun::TextType::Rtl)
+        return Font::ShapingCache::Direction::Rtl;
+    return Font::ShapingCache::Direction::Auto;
+}
+
+static hb_buffer_t* get_or_create_shaped_buffer(Utf16View const& string, Font const& font, GlyphRun::TextType text_type)
 {
-    auto const& metrics = font.pixel_metrics();
     auto& shaping_cache = font.shaping_cache();
 
-    // FIXME: The cache currently grows unbounded. We should have some limit and LRU mechanism.
-    auto get_or_create_buffer = [&] -> hb_buffer_t* {
-        if (string.length_in_code_units() == 1) {
-            auto code_unit = string.code_unit_at(0);
-            if (code_unit < 128) {
-                auto*& cache_slot = shaping_cache.single_ascii_character_map[code_unit];
-                if (!cache_slot) {
-                    cache_slot = setup_text_shaping(string, font, text_type);
-                }
-                return cache_slot;
-            }
-        }
-        if (auto it = shaping_cache.map.find(
-                string.hash(), [&](auto& candidate) { return candidate.key == string; });
-            it != shaping_cache.map.end()) {
-            return it->value;
+    if (string.length_in_code_units() == 1) {
+        auto code_unit = string.code_unit_at(0);
+        if (code_unit < 128) {
+            auto*& cache_slot = shaping_cache.single_ascii_character_map[code_unit];
+            if (!cache_slot)
+                cache_slot = setup_text_shaping(string, font, text_type);
+            return cache_slot;
         }
-        auto* buffer = setup_text_shaping(string, font, text_type);
-        shaping_cache.map.set(Utf16String::from_utf16(string), buffer);
+    }
+
+    auto direction = shaping_direction(string, text_type);
+    if (auto* buffer = shaping_cache.find(string, direction))
         return buffer;
-    };
 
-    hb_buffer_t* buffer = get_or_create_buffer();
+    auto* buffer = setup_text_shaping(string, font, text_type);
+    shaping_cache.set(string, direction, buffer);
+    return buffer;
+}
+
+NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type)
+{
+    auto const& metrics = font.pixel_metrics();
+
+    hb_buffer_t* buffer = get_or_create_shaped_buffer(string, font, text_type);
     u32 glyph_count;
     auto const* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
     auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
@@ -254,7 +266,7 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
 
 float measure_text_width(Utf16View const& string, Font const& font, float letter_spacing)
 {
-    auto* buffer = setup_text_shaping(string, font, GlyphRun::TextType::Common);
+    auto* buffer = get_or_create_shaped_buffer(string, font, GlyphRun::TextType::Common);
 
     u32 glyph_count;
     auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
@@ -263,7 +275,6 @@ float measure_text_width(Utf16View const& string, Font const& font, float letter
     for (size_t i = 0; i < glyph_count; ++i)
         point_x += positions[i].x_advance;
 
-    hb_buffer_destroy(buffer);
     return point_x / text_shaping_resolution + glyph_count * letter_spacing;
 }
 
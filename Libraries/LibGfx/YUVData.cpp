@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/SIMD.h>
+#include <LibGfx/Bitmap.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibGfx/YUVData.h>
@@ -206,4 +208,164 @@ SkYUVAPixmaps const& YUVData::skia_yuva_pixmaps() const
     return m_impl->get_or_create_pixmaps();
 }
 
+namespace {
+
+struct YUVToRGBConversion {
+    float y_offset;
+    float y_scale;
+    float uv_offset;
+    float uv_scale;
+
+    float cr_to_r;
+    float cb_to_g;
+    float cr_to_g;
+    float cb_to_b;
+
+    bool is_identity;
+};
+
+}
+
+static YUVToRGBConversion yuv_to_rgb_conversion(Details::YUVDataImpl const& impl)
+{
+    // Use the same matrix and range that Skia is given for GPU conversion.
+    auto color_space = impl.skia_yuv_color_space();
+    float kr = 0.2126f;
+    float kb = 0.0722f;
+    bool full_range = false;
+    switch (color_space) {
+    case kJPEG_Full_SkYUVColorSpace:
+        full_range = true;
+        [[fallthrough]];
+    case kRec601_Limited_SkYUVColorSpace:
+        kr = 0.299f;
+        kb = 0.114f;
+        break;
+    case kBT2020_8bit_Limited_SkYUVColorSpace:
+    case kBT2020_10bit_Limited_SkYUVColorSpace:
+    case kBT2020_12bit_Limited_SkYUVColorSpace:
+        kr = 0.2627f;
+        kb = 0.0593f;
+        break;
+    case kRec709_Full_SkYUVColorSpace:
+    case kIdentity_SkYUVColorSpace:
+        full_range = true;
+        break;
+    default:
+        break;
+    }
+    auto kg = 1.0f - kr - kb;
+
+    // Samples with more than 8 bits were scaled to fill the full 16-bit range, so the studio range offsets and
+    // scales are relative to the maximum value of the original bit depth.
+    auto bit_depth = clamp<u8>(impl.bit_depth, 8, 16);
+    auto max_value = static_cast<float>((1u << bit_depth) - 1);
+    auto scale_8_bit_value = [&](float value) { return value * static_cast<float>(1u << (bit_depth - 8)) / max_value; };
+
+    YUVToRGBConversion conversion {};
+    if (full_range) {
+        conversion.y_offset = 0.0f;
+        conversion.y_scale = 1.0f;
+        conversion.uv_offset = static_cast<float>(1u << (bit_depth - 1)) / max_value;
+        conversion.uv_scale = 1.0f;
+    } else {
+        conversion.y_offset = scale_8_bit_value(16.0f);
+        conversion.y_scale = 1.0f / scale_8_bit_value(219.0f);
+        conversion.uv_offset = scale_8_bit_value(128.0f);
+        conversion.uv_scale = 1.0f / scale_8_bit_value(224.0f);
+    }
+
+    conversion.cr_to_r = 2.0f * (1.0f - kr);
+    conversion.cb_to_g = 2.0f * kb * (1.0f - kb) / kg;
+    conversion.cr_to_g = 2.0f * kr * (1.0f - kr) / kg;
+    conversion.cb_to_b = 2.0f * (1.0f - kb);
+    conversion.is_identity = color_space == kIdentity_SkYUVColorSpace;
+    return conversion;
+}
+
+template<typename Sample>
+static void convert_yuv_to_bgra(Details::YUVDataImpl const& impl, YUVToRGBConversion const& conversion, Bitmap& bitmap)
+{
+    using AK::SIMD::f32x4;
+    using AK::SIMD::i32x4;
+
+    constexpr float sample_scale = 1.0f / NumericLimits<Sample>::max();
+    constexpr int lanes = 4;
+
+    auto width = impl.size.width();
+    auto height = impl.size.height();
+    auto uv_width = impl.subsampling.subsampled_size(impl.size).width();
+
+    auto const* y_plane = reinterpret_cast<Sample const*>(impl.y_buffer.data());
+    auto const* u_plane = reinterpret_cast<Sample const*>(impl.u_buffer.data());
+    auto const* v_plane = reinterpret_cast<Sample const*>(impl.v_buffer.data());
+
+    // The identity matrix stores GBR in the planes, so all of them use the luma range.
+    auto uv_offset = conversion.is_identity ? conversion.y_offset : conversion.uv_offset;
+    auto uv_scale = conversion.is_identity ? conversion.y_scale : conversion.uv_scale;
+
+    for (int row = 0; row < height; row++) {
+        auto uv_row = impl.subsampling.y() ? row / 2 : row;
+        auto const* y_row = y_plane + (static_cast<size_t>(row) * width);
+        auto const* u_row = u_plane + (static_cast<size_t>(uv_row) * uv_width);
+        auto const* v_row = v_plane + (static_cast<size_t>(uv_row) * uv_width);
+        auto* destination = bitmap.scanline(row);
+
+        for (int column = 0; column < width; column += lanes) {
+            f32x4 y;
+            f32x4 u;
+            f32x4 v;
+            for (int lane = 0; lane < lanes; lane++) {
+                auto x = min(column + lane, width - 1);
+                auto uv_x = impl.subsampling.x() ? x / 2 : x;
+                y[lane] = y_row[x];
+                u[lane] = u_row[uv_x];
+                v[lane] = v_row[uv_x];
+            }
+
+            y = (y * sample_scale - conversion.y_offset) * conversion.y_scale;
+            u = (u * sample_scale - uv_offset) * uv_scale;
+            v = (v * sample_scale - uv_offset) * uv_scale;
+
+            f32x4 r;
+            f32x4 g;
+            f32x4 b;
+            if (conversion.is_identity) {
+                r = v;
+                g = y;
+                b = u;
+            } else {
+                r = y + v * conversion.cr_to_r;
+                g = y - u * conversion.cb_to_g - v * conversion.cr_to_g;
+                b = y + u * conversion.cb_to_b;
+            }
+
+            auto r_values = __builtin_convertvector(r * 255.0f + 0.5f, i32x4);
+            auto g_values = __builtin_convertvector(g * 255.0f + 0.5f, i32x4);
+            auto b_values = __builtin_convertvector(b * 255.0f + 0.5f, i32x4);
+
+            auto pixel_count = min(lanes, width - column);
+            for (int lane = 0; lane < pixel_count; lane++) {
+                destination[column + lane] = 0xFF000000u
+                    | (static_cast<u32>(clamp(r_values[lane], 0, 255)) << 16)
+                    | (static_cast<u32>(clamp(g_values[lane], 0, 255)) << 8)
+                    | static_cast<u32>(clamp(b_values[lane], 0, 255));
+            }
+        }
+    }
+}
+
+ErrorOr<NonnullRefPtr<Bitmap>> YUVData::to_bitmap() const
+{
+    auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Premultiplied, m_impl->size));
+    auto conversion = yuv_to_rgb_conversion(*m_impl);
+
+    if (m_impl->bit_depth <= 8)
+        convert_yuv_to_bgra<u8>(*m_impl, conversion, *bitmap);
+    else
+        convert_yuv_to_bgra<u16>(*m_impl, conversion, *bitmap);
+
+    return bitmap;
+}
+
 }
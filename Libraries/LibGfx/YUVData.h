@@ -9,6 +9,7 @@
 #include <AK/Error.h>
 #include <AK/FixedArray.h>
 #include <AK/NonnullOwnPtr.h>
+#include <LibGfx/Forward.h>
 #include <LibGfx/Size.h>
 #include <LibMedia/Color/CodingIndependentCodePoints.h>
 #include <LibMedia/Subsampling.h>
@@ -44,6 +45,10 @@ public:
 
     SkYUVAPixmaps const& skia_yuva_pixmaps() const;
 
+    // Converts the planes to a BGRA8888 bitmap on the CPU, for when no GPU is available to do the conversion.
+    // The resulting colors are still in the color space described by the CICP.
+    ErrorOr<NonnullRefPtr<Bitmap>> to_bitmap() const;
+
 private:
     explicit YUVData(NonnullOwnPtr<Details::YUVDataImpl>);
 
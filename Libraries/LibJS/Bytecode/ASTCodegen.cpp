@@ -1997,6 +1997,7 @@ Optional<ScopedOperand> CallExpression::generate_bytecode(Bytecode::Generator& g
                 callee,
                 this_value,
                 expression_string_index,
+                generator.next_call_site_cache(),
                 argument_operands);
         }
     }
@@ -2192,7 +2193,7 @@ Optional<ScopedOperand> YieldExpression::generate_bytecode(Bytecode::Generator&
 
         // i. Let innerResult be ? Call(iteratorRecord.[[NextMethod]], iteratorRecord.[[Iterator]], « received.[[Value]] »).
         auto inner_result = generator.allocate_register();
-        generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(1, inner_result, next_method, iterator, OptionalNone {}, ReadonlySpan<ScopedOperand> { &received_completion_value, 1 });
+        generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(1, inner_result, next_method, iterator, OptionalNone {}, generator.next_call_site_cache(), ReadonlySpan<ScopedOperand> { &received_completion_value, 1 });
 
         // ii. If generatorKind is async, set innerResult to ? Await(innerResult).
         if (generator.is_in_async_generator_function()) {
@@ -2279,7 +2280,7 @@ Optional<ScopedOperand> YieldExpression::generate_bytecode(Bytecode::Generator&
         generator.switch_to_basic_block(throw_method_is_defined_block);
 
         // 1. Let innerResult be ? Call(throw, iterator, « received.[[Value]] »).
-        generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(1, inner_result, throw_method, iterator, OptionalNone {}, ReadonlySpan<ScopedOperand> { &received_completion_value, 1 });
+        generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(1, inner_result, throw_method, iterator, OptionalNone {}, generator.next_call_site_cache(), ReadonlySpan<ScopedOperand> { &received_completion_value, 1 });
 
         // 2. If generatorKind is async, set innerResult to ? Await(innerResult).
         if (generator.is_in_async_generator_function()) {
@@ -2339,7 +2340,7 @@ Optional<ScopedOperand> YieldExpression::generate_bytecode(Bytecode::Generator&
             generator.switch_to_basic_block(call_return_block);
 
             auto inner_result = generator.allocate_register();
-            generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(0, inner_result, return_method, iterator, OptionalNone {}, ReadonlySpan<ScopedOperand> {});
+            generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(0, inner_result, return_method, iterator, OptionalNone {}, generator.next_call_site_cache(), ReadonlySpan<ScopedOperand> {});
 
             auto awaited = generate_await(generator, inner_result, received_completion, received_completion_type, received_completion_value);
             generator.emit<Bytecode::Op::ThrowIfNotObject>(awaited);
@@ -2390,7 +2391,7 @@ Optional<ScopedOperand> YieldExpression::generate_bytecode(Bytecode::Generator&
 
         // iv. Let innerReturnResult be ? Call(return, iterator, « received.[[Value]] »).
         auto inner_return_result = generator.allocate_register();
-        generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(1, inner_return_result, return_method, iterator, OptionalNone {}, ReadonlySpan<ScopedOperand> { &received_completion_value, 1 });
+        generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(1, inner_return_result, return_method, iterator, OptionalNone {}, generator.next_call_site_cache(), ReadonlySpan<ScopedOperand> { &received_completion_value, 1 });
 
         // v. If generatorKind is async, set innerReturnResult to ? Await(innerReturnResult).
         if (generator.is_in_async_generator_function()) {
@@ -2775,7 +2776,7 @@ Optional<ScopedOperand> TaggedTemplateLiteral::generate_bytecode(Bytecode::Gener
     }
 
     auto dst = choose_dst(generator, preferred_dst);
-    generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(argument_regs.size(), dst, tag, this_value, OptionalNone {}, argument_regs);
+    generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(argument_regs.size(), dst, tag, this_value, OptionalNone {}, generator.next_call_site_cache(), argument_regs);
     return dst;
 }
 
@@ -4064,7 +4065,7 @@ static Optional<ScopedOperand> for_in_of_body_evaluation(Bytecode::Generator& ge
 
             // 4c. Set innerResult to Completion(Call(return, iterator)).
             auto inner_result = generator.allocate_register();
-            generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(0, inner_result, return_method, *head_result.iterator_object, OptionalNone {}, ReadonlySpan<ScopedOperand> {});
+            generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(0, inner_result, return_method, *head_result.iterator_object, OptionalNone {}, generator.next_call_site_cache(), ReadonlySpan<ScopedOperand> {});
 
             // 4d. Set innerResult to Completion(Await(innerResult.[[Value]])).
             auto received_completion = generator.allocate_register();
@@ -4143,7 +4144,7 @@ static Optional<ScopedOperand> for_in_of_body_evaluation(Bytecode::Generator& ge
                 generator.switch_to_basic_block(call_return_block);
 
                 auto inner_result = generator.allocate_register();
-                generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(0, inner_result, return_method, *head_result.iterator_object, OptionalNone {}, ReadonlySpan<ScopedOperand> {});
+                generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(0, inner_result, return_method, *head_result.iterator_object, OptionalNone {}, generator.next_call_site_cache(), ReadonlySpan<ScopedOperand> {});
 
                 auto received_completion = generator.allocate_register();
                 auto received_completion_type = generator.allocate_register();
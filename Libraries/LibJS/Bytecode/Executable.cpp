@@ -10,6 +10,7 @@
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/RegexTable.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/SharedFunctionInstanceData.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/SourceCode.h>
@@ -30,6 +31,7 @@ Executable::Executable(
     size_t number_of_global_variable_caches,
     size_t number_of_template_object_caches,
     size_t number_of_object_shape_caches,
+    size_t number_of_call_site_caches,
     size_t number_of_registers,
     Strict strict)
     : bytecode(move(bytecode))
@@ -46,10 +48,19 @@ Executable::Executable(
     global_variable_caches.resize(number_of_global_variable_caches);
     template_object_caches.resize(number_of_template_object_caches);
     object_shape_caches.resize(number_of_object_shape_caches);
+    call_site_caches.resize(number_of_call_site_caches);
 }
 
 Executable::~Executable() = default;
 
+void CallSiteCache::update(ECMAScriptFunctionObject const& callee)
+{
+    // NB: Only an empty entry (or one whose callee has been collected) is filled in, so that a call site that sees
+    //     many different callees doesn't keep rewriting it.
+    if (!this->callee)
+        this->callee = const_cast<SharedFunctionInstanceData&>(callee.shared_data());
+}
+
 void Executable::dump() const
 {
     warnln("\033[37;1mJS bytecode executable\033[0m \"{}\"", name);
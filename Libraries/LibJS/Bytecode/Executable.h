@@ -18,6 +18,7 @@
 #include <LibJS/Bytecode/Operand.h>
 #include <LibJS/Bytecode/PropertyKeyTable.h>
 #include <LibJS/Bytecode/StringTable.h>
+#include <LibJS/Bytecode/TypeFeedback.h>
 #include <LibJS/Export.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
@@ -87,6 +88,17 @@ struct ObjectShapeCache {
     Vector<u32> property_offsets;
 };
 
+// Represents one monomorphic inline cache used for calls.
+// It holds the shared data of the first callee seen at the call site that is known to be a normal ECMAScript function
+// whose bytecode has already been generated, so calling it again can skip the generic [[Call]] dispatch.
+// The entry is keyed on the shared data rather than the function object, so that all closures created from the same
+// function expression hit it. Call sites that see other callees just take the generic path for them.
+struct CallSiteCache {
+    void update(ECMAScriptFunctionObject const&);
+
+    GC::Weak<SharedFunctionInstanceData> callee;
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
@@ -114,6 +126,7 @@ public:
         size_t number_of_global_variable_caches,
         size_t number_of_template_object_caches,
         size_t number_of_object_shape_caches,
+        size_t number_of_call_site_caches,
         size_t number_of_registers,
         Strict);
 
@@ -125,6 +138,7 @@ public:
     Vector<GlobalVariableCache> global_variable_caches;
     Vector<TemplateObjectCache> template_object_caches;
     Vector<ObjectShapeCache> object_shape_caches;
+    Vector<CallSiteCache> call_site_caches;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<PropertyKeyTable> property_key_table;
@@ -158,6 +172,9 @@ public:
 
     Optional<PropertyKeyTableIndex> length_identifier;
 
+    // NB: Only allocated while collecting type feedback, see g_collect_type_feedback.
+    OwnPtr<ExecutableFeedback> feedback;
+
     Utf16String const& get_string(StringTableIndex index) const { return string_table->get(index); }
     Utf16FlyString const& get_identifier(IdentifierTableIndex index) const { return identifier_table->get(index); }
     PropertyKey const& get_property_key(PropertyKeyTableIndex index) const { return property_key_table->get(index); }
@@ -11,6 +11,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -232,6 +233,365 @@ void Generator::emit_function_declaration_instantiation(SharedFunctionInstanceDa
     }
 }
 
+struct RegisterOptimizationResult {
+    HashTable<Instruction const*> eliminated_instructions;
+    HashTable<Instruction const*> updates_with_unused_result;
+    HashTable<Instruction const*> conversions_of_numbers;
+};
+
+// NB: These instructions read all of their source operands before writing their result to `dst`, and touch no other operand.
+#define JS_ENUMERATE_OPS_WITH_WRITE_ONLY_DESTINATION(O) \
+    O(Add)                                              \
+    O(BitwiseAnd)                                       \
+    O(BitwiseNot)                                       \
+    O(BitwiseOr)                                        \
+    O(BitwiseXor)                                       \
+    O(Div)                                              \
+    O(Exp)                                              \
+    O(GetById)                                          \
+    O(GetByValue)                                       \
+    O(GetGlobal)                                        \
+    O(GreaterThan)                                      \
+    O(GreaterThanEquals)                                \
+    O(In)                                               \
+    O(InstanceOf)                                       \
+    O(LeftShift)                                        \
+    O(LessThan)                                         \
+    O(LessThanEquals)                                   \
+    O(LooselyEquals)                                    \
+    O(LooselyInequals)                                  \
+    O(Mod)                                              \
+    O(Mov)                                              \
+    O(Mul)                                              \
+    O(Not)                                              \
+    O(RightShift)                                       \
+    O(StrictlyEquals)                                   \
+    O(StrictlyInequals)                                 \
+    O(Sub)                                              \
+    O(ToBoolean)                                        \
+    O(ToInt32)                                          \
+    O(ToString)                                         \
+    O(Typeof)                                           \
+    O(UnaryMinus)                                       \
+    O(UnaryPlus)                                        \
+    O(UnsignedRightShift)
+
+static Operand* write_only_destination(Instruction& instruction)
+{
+#define __BYTECODE_OP(op)       \
+    case Instruction::Type::op: \
+        return const_cast<Operand*>(&static_cast<Op::op const&>(instruction).dst());
+
+    switch (instruction.type()) {
+        JS_ENUMERATE_OPS_WITH_WRITE_ONLY_DESTINATION(__BYTECODE_OP)
+    default:
+        return nullptr;
+    }
+
+#undef __BYTECODE_OP
+}
+
+// Returns true if every operand of the instruction, other than its write-only destination, is only read.
+static bool only_reads_source_operands(Instruction& instruction)
+{
+    if (write_only_destination(instruction))
+        return true;
+
+    switch (instruction.type()) {
+    case Instruction::Type::End:
+    case Instruction::Type::JumpFalse:
+    case Instruction::Type::JumpGreaterThan:
+    case Instruction::Type::JumpGreaterThanEquals:
+    case Instruction::Type::JumpIf:
+    case Instruction::Type::JumpLessThan:
+    case Instruction::Type::JumpLessThanEquals:
+    case Instruction::Type::JumpLooselyEquals:
+    case Instruction::Type::JumpLooselyInequals:
+    case Instruction::Type::JumpNullish:
+    case Instruction::Type::JumpStrictlyEquals:
+    case Instruction::Type::JumpStrictlyInequals:
+    case Instruction::Type::JumpTrue:
+    case Instruction::Type::JumpUndefined:
+    case Instruction::Type::Return:
+    case Instruction::Type::Throw:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns true if the instruction always writes a Number (never a BigInt) to its destination.
+static bool always_produces_number(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+    case Instruction::Type::ToInt32:
+    case Instruction::Type::UnaryPlus:
+    case Instruction::Type::UnsignedRightShift:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool is_optimizable_register(Operand const& operand)
+{
+    return operand.is_register() && operand.index() >= Register::reserved_register_count;
+}
+
+static Optional<Operand> register_store_destination(Instruction const& instruction)
+{
+    Operand destination { Operand::ShouldMakeInvalid::Indeed };
+    switch (instruction.type()) {
+    case Instruction::Type::Mov:
+        destination = static_cast<Op::Mov const&>(instruction).dst();
+        break;
+    case Instruction::Type::PostfixIncrement:
+        destination = static_cast<Op::PostfixIncrement const&>(instruction).dst();
+        break;
+    case Instruction::Type::PostfixDecrement:
+        destination = static_cast<Op::PostfixDecrement const&>(instruction).dst();
+        break;
+    default:
+        return {};
+    }
+    if (!is_optimizable_register(destination))
+        return {};
+    return destination;
+}
+
+// OPTIMIZATION: A register that is set to a constant and then only read by later instructions in the same
+//               block holds that constant wherever it is read, so read the constant directly instead.
+static void propagate_constants_in_block(Vector<Instruction*> const& instructions, Vector<u32>& occurrences, RegisterOptimizationResult& result)
+{
+    struct PendingConstant {
+        Instruction const* mov { nullptr };
+        Operand constant { Operand::ShouldMakeInvalid::Indeed };
+        Vector<Operand*> reads;
+    };
+    HashMap<u32, PendingConstant> pending_constants;
+
+    for (auto* instruction : instructions) {
+        auto* destination = write_only_destination(*instruction);
+        bool reads_sources = only_reads_source_operands(*instruction);
+
+        instruction->visit_operands([&](Operand& operand) {
+            if (!operand.is_register())
+                return;
+            auto it = pending_constants.find(operand.index());
+            if (it == pending_constants.end())
+                return;
+            if (!reads_sources || &operand == destination) {
+                pending_constants.remove(it);
+                return;
+            }
+            it->value.reads.append(&operand);
+            if (it->value.reads.size() + 1 != occurrences[operand.index()])
+                return;
+
+            // We've now seen every mention of the register, so nothing else can observe it.
+            occurrences[operand.index()] = 0;
+            result.eliminated_instructions.set(it->value.mov);
+            for (auto* read : it->value.reads)
+                *read = it->value.constant;
+            pending_constants.remove(it);
+        });
+
+        if (instruction->type() != Instruction::Type::Mov)
+            continue;
+        auto const& mov = static_cast<Op::Mov const&>(*instruction);
+        if (is_optimizable_register(mov.dst()) && mov.src().is_constant() && occurrences[mov.dst().index()] > 1)
+            pending_constants.set(mov.dst().index(), PendingConstant { instruction, mov.src(), {} });
+    }
+}
+
+// OPTIMIZATION: ToNumber of a value that is already a Number is the value itself, so a unary plus
+//               whose operand is known to be a Number at that point only needs to copy it.
+static void find_conversions_of_numbers_in_block(Vector<Instruction*> const& instructions, ReadonlySpan<Value> constants, RegisterOptimizationResult& result)
+{
+    HashTable<u32> operands_holding_numbers;
+
+    auto is_known_number = [&](Operand const& operand) {
+        if (operand.is_constant())
+            return constants[operand.index()].is_number();
+        return operands_holding_numbers.contains(operand.raw());
+    };
+
+    for (auto* instruction : instructions) {
+        if (result.eliminated_instructions.contains(instruction))
+            continue;
+
+        if (instruction->type() == Instruction::Type::UnaryPlus && is_known_number(static_cast<Op::UnaryPlus const&>(*instruction).src()))
+            result.conversions_of_numbers.set(instruction);
+
+        auto* destination = write_only_destination(*instruction);
+        if (!destination) {
+            // NB: We don't know which operands this instruction writes, so forget everything it mentions.
+            instruction->visit_operands([&](Operand& operand) {
+                operands_holding_numbers.remove(operand.raw());
+            });
+            continue;
+        }
+
+        bool produces_number = always_produces_number(*instruction)
+            || (instruction->type() == Instruction::Type::Mov && is_known_number(static_cast<Op::Mov const&>(*instruction).src()));
+        if (produces_number && (is_optimizable_register(*destination) || destination->is_local()))
+            operands_holding_numbers.set(destination->raw());
+        else
+            operands_holding_numbers.remove(destination->raw());
+    }
+}
+
+// OPTIMIZATION: A temporary that is computed and then immediately moved somewhere else can be
+//               computed into its final destination directly, which drops both the move and the temporary.
+static void coalesce_moves_in_block(Vector<Instruction*> const& instructions, Vector<u32>& occurrences, RegisterOptimizationResult& result)
+{
+    // NB: Unary pluses that only copy a Number are emitted as moves, so they can be coalesced as well.
+    auto move_source = [&](Instruction const& instruction) -> Optional<Operand> {
+        if (instruction.type() == Instruction::Type::Mov)
+            return static_cast<Op::Mov const&>(instruction).src();
+        if (result.conversions_of_numbers.contains(&instruction))
+            return static_cast<Op::UnaryPlus const&>(instruction).src();
+        return {};
+    };
+
+    Instruction* previous = nullptr;
+    for (auto* instruction : instructions) {
+        if (result.eliminated_instructions.contains(instruction))
+            continue;
+
+        if (auto source = move_source(*instruction); previous && source.has_value()) {
+            auto* destination = write_only_destination(*previous);
+            if (destination
+                && *destination == *source
+                && is_optimizable_register(*source)
+                && occurrences[source->index()] == 2) {
+                occurrences[source->index()] = 0;
+                *destination = *write_only_destination(*instruction);
+                result.eliminated_instructions.set(instruction);
+                continue;
+            }
+        }
+        previous = instruction;
+    }
+}
+
+// NB: This runs on the generated basic blocks before operands are rewritten to their final indices.
+//     We don't know which operands of an arbitrary instruction are read and which are written, so any
+//     mention of a register counts as a read, except for the destinations of Mov and of the postfix updates.
+//     A register that is only ever mentioned as such a destination is never read, so storing to it is dead.
+static RegisterOptimizationResult optimize_register_usage(Vector<NonnullOwnPtr<BasicBlock>> const& blocks, u32& number_of_registers, ReadonlySpan<Value> constants)
+{
+    RegisterOptimizationResult result;
+
+    Vector<u32> occurrences;
+    occurrences.resize(number_of_registers);
+    Vector<Vector<Instruction*>> instructions_by_block;
+    instructions_by_block.ensure_capacity(blocks.size());
+
+    for (auto& block : blocks) {
+        Vector<Instruction*> instructions;
+        InstructionStreamIterator it(block->instruction_stream());
+        while (!it.at_end()) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            ++it;
+
+            // OPTIMIZATION: Moving an operand into itself does nothing.
+            if (instruction.type() == Instruction::Type::Mov) {
+                auto const& mov = static_cast<Op::Mov const&>(instruction);
+                if (mov.dst() == mov.src()) {
+                    result.eliminated_instructions.set(&instruction);
+                    continue;
+                }
+            }
+
+            instruction.visit_operands([&](Operand& operand) {
+                if (operand.is_register())
+                    ++occurrences[operand.index()];
+            });
+            instructions.append(&instruction);
+        }
+        instructions_by_block.append(move(instructions));
+    }
+
+    for (auto const& instructions : instructions_by_block)
+        propagate_constants_in_block(instructions, occurrences, result);
+
+    for (auto const& instructions : instructions_by_block)
+        find_conversions_of_numbers_in_block(instructions, constants, result);
+
+    for (auto const& instructions : instructions_by_block)
+        coalesce_moves_in_block(instructions, occurrences, result);
+
+    Vector<u32> store_occurrences;
+    store_occurrences.resize(number_of_registers);
+    Vector<Instruction const*> stores;
+    for (auto const& instructions : instructions_by_block) {
+        for (auto const* instruction : instructions) {
+            if (result.eliminated_instructions.contains(instruction))
+                continue;
+            if (auto destination = register_store_destination(*instruction); destination.has_value()) {
+                ++store_occurrences[destination->index()];
+                stores.append(instruction);
+            }
+        }
+    }
+
+    // OPTIMIZATION: Remove moves into registers that are never read, and turn postfix updates whose
+    //               old value is never read into plain increments/decrements. Removing a move may leave
+    //               its source register unread as well, so keep going until nothing changes.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto const* instruction : stores) {
+            if (result.eliminated_instructions.contains(instruction) || result.updates_with_unused_result.contains(instruction))
+                continue;
+
+            auto destination = register_store_destination(*instruction).value();
+            if (occurrences[destination.index()] != store_occurrences[destination.index()])
+                continue;
+
+            --occurrences[destination.index()];
+            --store_occurrences[destination.index()];
+
+            if (instruction->type() == Instruction::Type::Mov) {
+                auto source = static_cast<Op::Mov const&>(*instruction).src();
+                if (source.is_register())
+                    --occurrences[source.index()];
+                result.eliminated_instructions.set(instruction);
+            } else {
+                result.updates_with_unused_result.set(instruction);
+            }
+            changed = true;
+        }
+    }
+
+    // OPTIMIZATION: Renumber the registers that are still mentioned so that they are contiguous,
+    //               which shrinks the register file of every execution context for this executable.
+    Vector<u32> new_register_indices;
+    new_register_indices.resize(number_of_registers);
+    u32 next_register = Register::reserved_register_count;
+    for (u32 i = 0; i < number_of_registers; ++i) {
+        if (i < Register::reserved_register_count)
+            new_register_indices[i] = i;
+        else if (occurrences[i] > 0)
+            new_register_indices[i] = next_register++;
+    }
+
+    for (auto const& instructions : instructions_by_block) {
+        for (auto* instruction : instructions) {
+            if (result.eliminated_instructions.contains(instruction))
+                continue;
+            instruction->visit_operands([&](Operand& operand) {
+                if (operand.is_register() && occurrences[operand.index()] > 0)
+                    operand = Operand { Operand::Type::Register, new_register_indices[operand.index()] };
+            });
+        }
+    }
+
+    number_of_registers = next_register;
+    return result;
+}
+
 GC::Ref<Executable> Generator::compile(VM& vm, ASTNode const& node, FunctionKind enclosing_function_kind, GC::Ptr<SharedFunctionInstanceData const> shared_function_instance_data, MustPropagateCompletion must_propagate_completion, BuiltinAbstractOperationsEnabled builtin_abstract_operations_enabled, Vector<LocalVariable> local_variable_names)
 {
     Generator generator(vm, shared_function_instance_data, must_propagate_completion, builtin_abstract_operations_enabled);
@@ -289,6 +649,10 @@ GC::Ref<Executable> Generator::compile(VM& vm, ASTNode const& node, FunctionKind
         }
     }
 
+    RegisterOptimizationResult register_optimizations;
+    if (g_optimize_bytecode)
+        register_optimizations = optimize_register_usage(generator.m_root_basic_blocks, generator.m_next_register, generator.m_constants);
+
     size_t size_needed = 0;
     for (auto& block : generator.m_root_basic_blocks) {
         size_needed += block->size();
@@ -397,6 +761,36 @@ GC::Ref<Executable> Generator::compile(VM& vm, ASTNode const& node, FunctionKind
         while (!it.at_end()) {
             auto& instruction = const_cast<Instruction&>(*it);
 
+            if (register_optimizations.eliminated_instructions.contains(&instruction)) {
+                ++it;
+                continue;
+            }
+
+            if (register_optimizations.updates_with_unused_result.contains(&instruction)) {
+                emit_source_map_entry(it.offset());
+                if (instruction.type() == Instruction::Type::PostfixIncrement) {
+                    Op::Increment increment(static_cast<Op::PostfixIncrement const&>(instruction).src());
+                    increment.set_strict(instruction.strict());
+                    bytecode.append(reinterpret_cast<u8 const*>(&increment), increment.length());
+                } else {
+                    Op::Decrement decrement(static_cast<Op::PostfixDecrement const&>(instruction).src());
+                    decrement.set_strict(instruction.strict());
+                    bytecode.append(reinterpret_cast<u8 const*>(&decrement), decrement.length());
+                }
+                ++it;
+                continue;
+            }
+
+            if (register_optimizations.conversions_of_numbers.contains(&instruction)) {
+                emit_source_map_entry(it.offset());
+                auto const& unary_plus = static_cast<Op::UnaryPlus const&>(instruction);
+                Op::Mov mov(unary_plus.dst(), unary_plus.src());
+                mov.set_strict(instruction.strict());
+                bytecode.append(reinterpret_cast<u8 const*>(&mov), mov.length());
+                ++it;
+                continue;
+            }
+
             if (instruction.type() == Instruction::Type::Jump) {
                 auto& jump = static_cast<Bytecode::Op::Jump&>(instruction);
 
@@ -496,6 +890,7 @@ GC::Ref<Executable> Generator::compile(VM& vm, ASTNode const& node, FunctionKind
         generator.m_next_global_variable_cache,
         generator.m_next_template_object_cache,
         generator.m_next_object_shape_cache,
+        generator.m_next_call_site_cache,
         generator.m_next_register,
         generator.m_strict);
 
@@ -572,6 +967,7 @@ GC::Ref<Executable> Generator::generate_from_ast_node(VM& vm, ASTNode const& nod
 GC::Ref<Executable> Generator::generate_from_function(VM& vm, GC::Ref<SharedFunctionInstanceData const> shared_function_instance_data, BuiltinAbstractOperationsEnabled builtin_abstract_operations_enabled)
 {
     VERIFY(!shared_function_instance_data->m_executable);
+    VERIFY(shared_function_instance_data->m_has_function_declaration_instantiation_data);
     return compile(vm, *shared_function_instance_data->m_ecmascript_code, shared_function_instance_data->m_kind, shared_function_instance_data, MustPropagateCompletion::No, builtin_abstract_operations_enabled, shared_function_instance_data->m_local_variables_names);
 }
 
@@ -1810,6 +2206,7 @@ void Generator::generate_builtin_abstract_operation(Identifier const& builtin_id
             callee,
             this_value,
             expression_string_index,
+            next_call_site_cache(),
             argument_operands);
         return;
     }
@@ -1877,6 +2274,7 @@ void Generator::generate_builtin_abstract_operation(Identifier const& builtin_id
             add_constant(m_vm.current_realm()->intrinsics().snake_name##_abstract_operation_function()),     \
             add_constant(js_undefined()),                                                                    \
             intern_string(builtin_identifier.string().to_utf16_string()),                                    \
+            next_call_site_cache(),                                                                          \
             argument_operands);                                                                              \
         return;                                                                                              \
     }
@@ -18,6 +18,7 @@
 #include <LibJS/Bytecode/Label.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/PropertyAccess.h>
+#include <LibJS/Bytecode/TypeFeedback.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
@@ -42,6 +43,7 @@
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/Reference.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -51,6 +53,13 @@
 namespace JS::Bytecode {
 
 bool g_dump_bytecode = false;
+bool g_optimize_bytecode = false;
+
+ALWAYS_INLINE static void record_operand_types(Interpreter& interpreter, Value lhs, Value rhs)
+{
+    if (g_collect_type_feedback) [[unlikely]]
+        feedback_for_current_instruction(interpreter.vm()).record_operands(lhs, rhs);
+}
 
 ALWAYS_INLINE static ThrowCompletionOr<bool> loosely_inequals(VM& vm, Value src1, Value src2)
 {
@@ -264,6 +273,9 @@ void Interpreter::run_bytecode(size_t entry_point)
 
     for (;;) {
     start:
+        if (g_sampling_profiler_sample_requested.load(AK::MemoryOrder::memory_order_relaxed)) [[unlikely]]
+            vm().sampling_profiler().take_sample();
+
         for (;;) {
             goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
 
@@ -330,6 +342,7 @@ void Interpreter::run_bytecode(size_t entry_point)
         auto& instruction = *reinterpret_cast<Op::Jump##op_TitleCase const*>(&bytecode[program_counter]);               \
         auto lhs = get(instruction.lhs());                                                                              \
         auto rhs = get(instruction.rhs());                                                                              \
+        record_operand_types(*this, lhs, rhs);                                                                          \
         if (lhs.is_number() && rhs.is_number()) [[likely]] {                                                            \
             bool result;                                                                                                \
             if (lhs.is_int32() && rhs.is_int32()) {                                                                     \
@@ -563,9 +576,20 @@ ThrowCompletionOr<Value> Interpreter::run_executable(ExecutionContext& context,
 {
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter will run unit {}", &executable);
 
+    // NB: Outside of the outermost run of the interpreter no JavaScript is running, e.g. while the event loop
+    //     waits for work. The sampling profiler needs to know, so it doesn't charge that time to JavaScript.
+    bool is_outermost_run = !m_running_execution_context;
+    if (is_outermost_run) [[unlikely]] {
+        if (auto* sampling_profiler = vm().running_sampling_profiler())
+            sampling_profiler->did_start_running_javascript();
+    }
+
     // NOTE: This is how we "push" a new execution context onto the interpreter stack.
     TemporaryChange restore_running_execution_context { m_running_execution_context, &context };
 
+    if (g_collect_type_feedback) [[unlikely]]
+        ++feedback_for_executable(executable).entry_count;
+
     context.executable = executable;
     context.global_object = realm().global_object();
     context.global_declarative_environment = realm().global_environment().declarative_record();
@@ -606,6 +630,11 @@ ThrowCompletionOr<Value> Interpreter::run_executable(ExecutionContext& context,
     vm().run_queued_promise_jobs();
     vm().finish_execution_generation();
 
+    if (is_outermost_run) [[unlikely]] {
+        if (auto* sampling_profiler = vm().running_sampling_profiler())
+            sampling_profiler->will_stop_running_javascript();
+    }
+
     auto exception = reg(Register::exception());
     if (!exception.is_special_empty_value()) [[unlikely]]
         return throw_completion(exception);
@@ -727,6 +756,13 @@ inline ThrowCompletionOr<Value> get_by_value(VM& vm, Optional<IdentifierTableInd
         // For "non-typed arrays":
         if (!object.may_interfere_with_indexed_property_access()
             && object_storage) {
+            if (object_storage->is_simple_storage()) {
+                auto const& simple_storage = static_cast<SimpleIndexedPropertyStorage const&>(*object_storage);
+                // OPTIMIZATION: Numbers can't be accessors, so any element that is present can be returned as-is.
+                if (is_number_elements_kind(simple_storage.elements_kind()) && simple_storage.inline_has_index(index))
+                    return simple_storage.elements().data()[index];
+            }
+
             auto maybe_value = [&] {
                 if (object_storage->is_simple_storage())
                     return static_cast<SimpleIndexedPropertyStorage const*>(object_storage)->inline_get(index);
@@ -938,11 +974,11 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Utf16Fl
         if (storage
             && storage->is_simple_storage()
             && !object.may_interfere_with_indexed_property_access()) {
-            auto maybe_value = storage->get(index);
-            if (maybe_value.has_value()) {
-                auto existing_value = maybe_value->value;
-                if (!existing_value.is_accessor()) {
-                    storage->put(index, value);
+            auto& simple_storage = static_cast<SimpleIndexedPropertyStorage&>(*storage);
+            if (simple_storage.inline_has_index(index)) {
+                // NB: Numbers can't be accessors, so we only need to look at the existing element for other kinds.
+                if (is_number_elements_kind(simple_storage.elements_kind()) || !simple_storage.elements().data()[index].is_accessor()) {
+                    simple_storage.inline_put_existing(index, value);
                     return {};
                 }
             }
@@ -1366,6 +1402,7 @@ namespace JS::Bytecode::Op {
         auto& vm = interpreter.vm();                                                            \
         auto lhs = interpreter.get(m_lhs);                                                      \
         auto rhs = interpreter.get(m_rhs);                                                      \
+        record_operand_types(interpreter, lhs, rhs);                                            \
         interpreter.set(m_dst, Value { TRY(op_snake_case(vm, lhs, rhs)) });                     \
         return {};                                                                              \
     }
@@ -1377,6 +1414,7 @@ ThrowCompletionOr<void> Add::execute_impl(Bytecode::Interpreter& interpreter) co
     auto& vm = interpreter.vm();
     auto const lhs = interpreter.get(m_lhs);
     auto const rhs = interpreter.get(m_rhs);
+    record_operand_types(interpreter, lhs, rhs);
 
     if (lhs.is_number() && rhs.is_number()) [[likely]] {
         if (lhs.is_int32() && rhs.is_int32()) {
@@ -1401,6 +1439,7 @@ ThrowCompletionOr<void> Mul::execute_impl(Bytecode::Interpreter& interpreter) co
     auto& vm = interpreter.vm();
     auto const lhs = interpreter.get(m_lhs);
     auto const rhs = interpreter.get(m_rhs);
+    record_operand_types(interpreter, lhs, rhs);
 
     if (lhs.is_number() && rhs.is_number()) [[likely]] {
         if (lhs.is_int32() && rhs.is_int32()) {
@@ -1435,6 +1474,7 @@ ThrowCompletionOr<void> Div::execute_impl(Bytecode::Interpreter& interpreter) co
     auto& vm = interpreter.vm();
     auto const lhs = interpreter.get(m_lhs);
     auto const rhs = interpreter.get(m_rhs);
+    record_operand_types(interpreter, lhs, rhs);
 
     if (lhs.is_number() && rhs.is_number()) [[likely]] {
         interpreter.set(m_dst, Value(lhs.as_double() / rhs.as_double()));
@@ -1450,6 +1490,7 @@ ThrowCompletionOr<void> Mod::execute_impl(Bytecode::Interpreter& interpreter) co
     auto& vm = interpreter.vm();
     auto const lhs = interpreter.get(m_lhs);
     auto const rhs = interpreter.get(m_rhs);
+    record_operand_types(interpreter, lhs, rhs);
 
     if (lhs.is_number() && rhs.is_number()) [[likely]] {
         if (lhs.is_int32() && rhs.is_int32()) {
@@ -1484,6 +1525,7 @@ ThrowCompletionOr<void> Sub::execute_impl(Bytecode::Interpreter& interpreter) co
     auto& vm = interpreter.vm();
     auto const lhs = interpreter.get(m_lhs);
     auto const rhs = interpreter.get(m_rhs);
+    record_operand_types(interpreter, lhs, rhs);
 
     if (lhs.is_number() && rhs.is_number()) [[likely]] {
         if (lhs.is_int32() && rhs.is_int32()) {
@@ -1615,6 +1657,7 @@ ThrowCompletionOr<void> LessThan::execute_impl(Bytecode::Interpreter& interprete
     auto& vm = interpreter.vm();
     auto const lhs = interpreter.get(m_lhs);
     auto const rhs = interpreter.get(m_rhs);
+    record_operand_types(interpreter, lhs, rhs);
     if (lhs.is_number() && rhs.is_number()) [[likely]] {
         if (lhs.is_int32() && rhs.is_int32()) {
             interpreter.set(m_dst, Value(lhs.as_i32() < rhs.as_i32()));
@@ -1632,6 +1675,7 @@ ThrowCompletionOr<void> LessThanEquals::execute_impl(Bytecode::Interpreter& inte
     auto& vm = interpreter.vm();
     auto const lhs = interpreter.get(m_lhs);
     auto const rhs = interpreter.get(m_rhs);
+    record_operand_types(interpreter, lhs, rhs);
     if (lhs.is_number() && rhs.is_number()) [[likely]] {
         if (lhs.is_int32() && rhs.is_int32()) {
             interpreter.set(m_dst, Value(lhs.as_i32() <= rhs.as_i32()));
@@ -1649,6 +1693,7 @@ ThrowCompletionOr<void> GreaterThan::execute_impl(Bytecode::Interpreter& interpr
     auto& vm = interpreter.vm();
     auto const lhs = interpreter.get(m_lhs);
     auto const rhs = interpreter.get(m_rhs);
+    record_operand_types(interpreter, lhs, rhs);
     if (lhs.is_number() && rhs.is_number()) [[likely]] {
         if (lhs.is_int32() && rhs.is_int32()) {
             interpreter.set(m_dst, Value(lhs.as_i32() > rhs.as_i32()));
@@ -1666,6 +1711,7 @@ ThrowCompletionOr<void> GreaterThanEquals::execute_impl(Bytecode::Interpreter& i
     auto& vm = interpreter.vm();
     auto const lhs = interpreter.get(m_lhs);
     auto const rhs = interpreter.get(m_rhs);
+    record_operand_types(interpreter, lhs, rhs);
     if (lhs.is_number() && rhs.is_number()) [[likely]] {
         if (lhs.is_int32() && rhs.is_int32()) {
             interpreter.set(m_dst, Value(lhs.as_i32() >= rhs.as_i32()));
@@ -2495,6 +2541,19 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
     VERIFY_NOT_REACHED();
 }
 
+static ALWAYS_INLINE void copy_call_arguments(Bytecode::Interpreter& interpreter, ExecutionContext& callee_context, ReadonlySpan<Operand> arguments)
+{
+    auto* callee_context_argument_values = callee_context.arguments.data();
+    auto const callee_context_argument_count = callee_context.arguments.size();
+    auto const insn_argument_count = arguments.size();
+
+    for (size_t i = 0; i < insn_argument_count; ++i)
+        callee_context_argument_values[i] = interpreter.get(arguments.data()[i]);
+    for (size_t i = insn_argument_count; i < callee_context_argument_count; ++i)
+        callee_context_argument_values[i] = js_undefined();
+    callee_context.passed_argument_count = insn_argument_count;
+}
+
 template<CallType call_type>
 static ThrowCompletionOr<void> execute_call(
     Bytecode::Interpreter& interpreter,
@@ -2509,6 +2568,9 @@ static ThrowCompletionOr<void> execute_call(
 
     auto& function = callee.as_function();
 
+    if (g_collect_type_feedback) [[unlikely]]
+        feedback_for_current_instruction(interpreter.vm()).record_callee(function);
+
     ExecutionContext* callee_context = nullptr;
     size_t registers_and_locals_count = 0;
     size_t constants_count = 0;
@@ -2516,15 +2578,7 @@ static ThrowCompletionOr<void> execute_call(
     function.get_stack_frame_size(registers_and_locals_count, constants_count, argument_count);
     ALLOCATE_EXECUTION_CONTEXT_ON_NATIVE_STACK_WITHOUT_CLEARING_ARGS(callee_context, registers_and_locals_count, constants_count, max(arguments.size(), argument_count));
 
-    auto* callee_context_argument_values = callee_context->arguments.data();
-    auto const callee_context_argument_count = callee_context->arguments.size();
-    auto const insn_argument_count = arguments.size();
-
-    for (size_t i = 0; i < insn_argument_count; ++i)
-        callee_context_argument_values[i] = interpreter.get(arguments.data()[i]);
-    for (size_t i = insn_argument_count; i < callee_context_argument_count; ++i)
-        callee_context_argument_values[i] = js_undefined();
-    callee_context->passed_argument_count = insn_argument_count;
+    copy_call_arguments(interpreter, *callee_context, arguments);
 
     Value retval;
     if (call_type == CallType::DirectEval && callee == interpreter.realm().intrinsics().eval_function()) {
@@ -2538,9 +2592,45 @@ static ThrowCompletionOr<void> execute_call(
     return {};
 }
 
+// NB: The callee was cached at this call site, so we already know that it's callable and how big its stack frame is.
+static ThrowCompletionOr<void> execute_cached_call(
+    Bytecode::Interpreter& interpreter,
+    ECMAScriptFunctionObject& function,
+    Value this_value,
+    ReadonlySpan<Operand> arguments,
+    Operand dst)
+{
+    if (g_collect_type_feedback) [[unlikely]]
+        feedback_for_current_instruction(interpreter.vm()).record_callee(function);
+
+    auto const& executable = *function.bytecode_executable();
+
+    ExecutionContext* callee_context = nullptr;
+    auto argument_count = max(arguments.size(), static_cast<size_t>(function.formal_parameter_count()));
+    ALLOCATE_EXECUTION_CONTEXT_ON_NATIVE_STACK_WITHOUT_CLEARING_ARGS(callee_context, executable.registers_and_locals_count, executable.constants.size(), argument_count);
+
+    copy_call_arguments(interpreter, *callee_context, arguments);
+
+    interpreter.set(dst, TRY(function.internal_call_from_call_site_cache(*callee_context, this_value)));
+    return {};
+}
+
 ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) const
 {
-    return execute_call<CallType::Call>(interpreter, interpreter.get(m_callee), interpreter.get(m_this_value), { m_arguments, m_argument_count }, m_dst, m_expression_string, strict());
+    auto callee = interpreter.get(m_callee);
+    auto& cache = interpreter.current_executable().call_site_caches[m_cache_index];
+
+    if (callee.is_object()) {
+        if (auto* function = as_if<ECMAScriptFunctionObject>(callee.as_object()); function && cache.callee.ptr().ptr() == &function->shared_data())
+            return execute_cached_call(interpreter, *function, interpreter.get(m_this_value), { m_arguments, m_argument_count }, m_dst);
+    }
+
+    TRY(execute_call<CallType::Call>(interpreter, callee, interpreter.get(m_this_value), { m_arguments, m_argument_count }, m_dst, m_expression_string, strict()));
+
+    // NB: The callee has been compiled by now if it's an ECMAScript function, so we can tell whether it can be cached.
+    if (auto* function = as_if<ECMAScriptFunctionObject>(callee.as_object()); function && function->can_be_cached_at_call_site())
+        cache.update(*function);
+    return {};
 }
 
 NEVER_INLINE ThrowCompletionOr<void> CallConstruct::execute_impl(Bytecode::Interpreter& interpreter) const
@@ -2579,6 +2669,9 @@ static ThrowCompletionOr<void> call_with_argument_array(
 
     auto& function = callee.as_function();
 
+    if (g_collect_type_feedback) [[unlikely]]
+        feedback_for_current_instruction(interpreter.vm()).record_callee(function);
+
     auto& argument_array = arguments.as_array();
     auto argument_array_length = argument_array.indexed_properties().array_like_size();
 
@@ -8,6 +8,7 @@
 
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/IdentifierTable.h>
+#include <LibJS/Bytecode/TypeFeedback.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Completion.h>
@@ -71,6 +72,9 @@ ALWAYS_INLINE ThrowCompletionOr<GC::Ref<Object>> base_object_for_get(VM& vm, Val
 template<GetByIdMode mode, typename GetBaseIdentifier, typename GetPropertyName>
 ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_base_identifier, GetPropertyName get_property_name, Value base_value, Value this_value, PropertyLookupCache& cache)
 {
+    if (g_collect_type_feedback) [[unlikely]]
+        record_property_lookup_cache_access(vm, cache);
+
     if constexpr (mode == GetByIdMode::Length) {
         if (base_value.is_string()) {
             return Value(base_value.as_string().length_in_utf16_code_units());
@@ -133,6 +137,9 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
             }
         }
     }
+    if (g_collect_type_feedback) [[unlikely]]
+        record_property_lookup_cache_miss(vm, cache);
+
     GC::Ptr<PrototypeChainValidity> prototype_chain_validity;
     if (shape.prototype())
         prototype_chain_validity = shape.prototype()->shape().prototype_chain_validity();
@@ -232,6 +239,9 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
     case PutKind::Normal: {
         auto this_value_object = MUST(this_value.to_object(vm));
         auto& from_shape = this_value_object->shape();
+        if (caches && g_collect_type_feedback) [[unlikely]]
+            record_property_lookup_cache_access(vm, *caches);
+
         if (caches) [[likely]] {
             for (size_t i = 0; i < caches->entries.size(); ++i) {
                 switch (caches->types[i]) {
@@ -321,6 +331,9 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
             }
         }
 
+        if (caches && g_collect_type_feedback) [[unlikely]]
+            record_property_lookup_cache_miss(vm, *caches);
+
         CacheableSetPropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
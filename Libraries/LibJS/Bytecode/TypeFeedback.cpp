@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/TypeFeedback.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/VM.h>
+
+namespace JS::Bytecode {
+
+bool g_collect_type_feedback = false;
+
+static Vector<GC::Weak<Executable>>& executables_with_feedback()
+{
+    static Vector<GC::Weak<Executable>> executables;
+    return executables;
+}
+
+ExecutableFeedback::ExecutableFeedback(Executable const& executable)
+{
+    instruction_slots.resize_with_default_value(executable.bytecode.size() / alignof(Instruction), NumericLimits<u32>::max());
+    property_lookups.resize(executable.property_lookup_caches.size());
+}
+
+ExecutableFeedback& feedback_for_executable(Executable& executable)
+{
+    if (!executable.feedback) {
+        executable.feedback = make<ExecutableFeedback>(executable);
+        executables_with_feedback().append(executable);
+    }
+    return *executable.feedback;
+}
+
+ObservedTypes observed_type_of(Value value)
+{
+    if (value.is_int32())
+        return ObservedTypes::Int32;
+    if (value.is_number())
+        return ObservedTypes::Double;
+    if (value.is_string())
+        return ObservedTypes::String;
+    if (value.is_object())
+        return ObservedTypes::Object;
+    return ObservedTypes::Other;
+}
+
+void InstructionFeedback::record_operands(Value lhs, Value rhs)
+{
+    ++execution_count;
+    lhs_types |= observed_type_of(lhs);
+    rhs_types |= observed_type_of(rhs);
+}
+
+void InstructionFeedback::record_callee(Object& callee)
+{
+    ++execution_count;
+    if (has_seen_multiple_callees)
+        return;
+    if (!first_callee && execution_count == 1) {
+        first_callee = callee;
+        return;
+    }
+    // NB: If the first callee has been garbage collected, we can't tell whether this is the same one,
+    //     so we err on the side of reporting the site as polymorphic.
+    if (first_callee.ptr().ptr() != &callee)
+        has_seen_multiple_callees = true;
+}
+
+static bool has_multiple_types(ObservedTypes types)
+{
+    auto bits = to_underlying(types);
+    return bits & (bits - 1);
+}
+
+bool InstructionFeedback::is_polymorphic() const
+{
+    return has_multiple_types(lhs_types) || has_multiple_types(rhs_types) || has_seen_multiple_callees;
+}
+
+InstructionFeedback& feedback_for_current_instruction(VM& vm)
+{
+    auto& context = vm.running_execution_context();
+    auto& executable_feedback = feedback_for_executable(*context.executable);
+    auto& slot = executable_feedback.instruction_slots[context.program_counter / alignof(Instruction)];
+    if (slot == NumericLimits<u32>::max()) {
+        slot = executable_feedback.instructions.size();
+        executable_feedback.instructions.append({ .bytecode_offset = context.program_counter });
+    }
+    return executable_feedback.instructions[slot];
+}
+
+static InstructionFeedback* feedback_for_property_lookup_cache(VM& vm, PropertyLookupCache const& cache)
+{
+    // NB: Property lookup caches are also used from native code, where no bytecode is running,
+    //     and those caches don't belong to any executable.
+    if (vm.execution_context_stack().is_empty())
+        return nullptr;
+    auto& context = vm.running_execution_context();
+    if (!context.executable)
+        return nullptr;
+    auto caches = context.executable->property_lookup_caches.span();
+    if (&cache < caches.data() || &cache >= caches.data() + caches.size())
+        return nullptr;
+    auto& feedback = feedback_for_executable(*context.executable).property_lookups[&cache - caches.data()];
+    feedback.bytecode_offset = context.program_counter;
+    return &feedback;
+}
+
+void record_property_lookup_cache_access(VM& vm, PropertyLookupCache const& cache)
+{
+    if (auto* feedback = feedback_for_property_lookup_cache(vm, cache))
+        ++feedback->execution_count;
+}
+
+void record_property_lookup_cache_miss(VM& vm, PropertyLookupCache const& cache)
+{
+    if (auto* feedback = feedback_for_property_lookup_cache(vm, cache))
+        ++feedback->cache_miss_count;
+}
+
+Vector<GC::Ref<Executable>> executables_with_type_feedback()
+{
+    Vector<GC::Ref<Executable>> executables;
+    for (auto& executable : executables_with_feedback()) {
+        if (executable)
+            executables.append(*executable);
+    }
+    return executables;
+}
+
+static ByteString observed_types_to_string(ObservedTypes types)
+{
+    if (types == ObservedTypes::None)
+        return "-";
+
+    StringBuilder builder;
+    auto append_if_observed = [&](ObservedTypes type, StringView name) {
+        if (!has_flag(types, type))
+            return;
+        if (!builder.is_empty())
+            builder.append('|');
+        builder.append(name);
+    };
+    append_if_observed(ObservedTypes::Int32, "int32"sv);
+    append_if_observed(ObservedTypes::Double, "double"sv);
+    append_if_observed(ObservedTypes::String, "string"sv);
+    append_if_observed(ObservedTypes::Object, "object"sv);
+    append_if_observed(ObservedTypes::Other, "other"sv);
+    return builder.to_byte_string();
+}
+
+static ByteString source_location_at(Executable const& executable, u32 offset)
+{
+    auto range = executable.source_range_at(offset);
+    if (!range.source_code)
+        return "(unknown)";
+    auto realized_range = range.realize();
+    return ByteString::formatted("{}:{}:{}", realized_range.filename(), realized_range.start.line, realized_range.start.column);
+}
+
+void dump_type_feedback(size_t max_number_of_executables)
+{
+    auto executables = executables_with_type_feedback();
+
+    quick_sort(executables, [](auto const& a, auto const& b) {
+        return a->feedback->entry_count > b->feedback->entry_count;
+    });
+
+    if (executables.size() > max_number_of_executables)
+        executables.shrink(max_number_of_executables);
+
+    warnln("Type feedback for the {} most entered executables:", executables.size());
+    for (auto const& executable : executables) {
+        auto const& feedback = *executable->feedback;
+        warnln("");
+        warnln("{:>10} entries  {} ({})", feedback.entry_count, executable->name.is_empty() ? "(anonymous)"_utf16_fly_string : executable->name, source_location_at(*executable, 0));
+
+        Vector<InstructionFeedback const*> interesting_instructions;
+        auto collect_interesting_instructions = [&](Vector<InstructionFeedback> const& slots) {
+            for (auto const& slot : slots) {
+                if (slot.is_polymorphic() || slot.cache_miss_count > 0)
+                    interesting_instructions.append(&slot);
+            }
+        };
+        collect_interesting_instructions(feedback.instructions);
+        collect_interesting_instructions(feedback.property_lookups);
+        quick_sort(interesting_instructions, [](auto const* a, auto const* b) {
+            return a->execution_count > b->execution_count;
+        });
+
+        for (auto const* instruction_feedback : interesting_instructions) {
+            auto offset = instruction_feedback->bytecode_offset;
+            InstructionStreamIterator it(executable->bytecode.span().slice(offset), executable.ptr());
+
+            StringBuilder builder;
+            builder.appendff("  [{:4x}] {:>10}x {}", offset, instruction_feedback->execution_count, (*it).to_byte_string(*executable));
+            if (instruction_feedback->lhs_types != ObservedTypes::None || instruction_feedback->rhs_types != ObservedTypes::None)
+                builder.appendff(" -- types: {} / {}", observed_types_to_string(instruction_feedback->lhs_types), observed_types_to_string(instruction_feedback->rhs_types));
+            if (instruction_feedback->has_seen_multiple_callees)
+                builder.append(" -- polymorphic callee"sv);
+            if (instruction_feedback->cache_miss_count > 0)
+                builder.appendff(" -- cache misses: {}", instruction_feedback->cache_miss_count);
+            warnln("{}", builder.string_view());
+        }
+    }
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/EnumBits.h>
+#include <AK/Vector.h>
+#include <LibGC/Weak.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+
+namespace JS::Bytecode {
+
+// When enabled, the interpreter records what it observes at each instruction (operand types,
+// call targets and property lookup cache misses) in the running executable's ExecutableFeedback.
+// This is meant for diagnosing slow code and as input for future specialized instructions.
+JS_API extern bool g_collect_type_feedback;
+
+enum class ObservedTypes : u8 {
+    None = 0,
+    Int32 = 1 << 0,
+    Double = 1 << 1,
+    String = 1 << 2,
+    Object = 1 << 3,
+    Other = 1 << 4,
+};
+
+AK_ENUM_BITWISE_OPERATORS(ObservedTypes);
+
+struct JS_API InstructionFeedback {
+    void record_operands(Value lhs, Value rhs);
+    void record_callee(Object& callee);
+
+    // NB: An instruction is polymorphic if it has seen more than one kind of operand on either side,
+    //     or more than one distinct callee.
+    [[nodiscard]] bool is_polymorphic() const;
+
+    // NB: Offset of the instruction that recorded into this slot, so that it can be shown in reports.
+    u32 bytecode_offset { 0 };
+    u64 execution_count { 0 };
+    ObservedTypes lhs_types { ObservedTypes::None };
+    ObservedTypes rhs_types { ObservedTypes::None };
+
+    GC::Weak<Object> first_callee;
+    bool has_seen_multiple_callees { false };
+
+    u64 cache_miss_count { 0 };
+};
+
+struct JS_API ExecutableFeedback {
+    explicit ExecutableFeedback(Executable const&);
+
+    u64 entry_count { 0 };
+
+    // One slot per instruction that has recorded operand types or callees, in the order they first did so.
+    Vector<InstructionFeedback> instructions;
+
+    // NB: Maps each instruction to its slot in `instructions`, indexed by bytecode offset / alignof(Instruction).
+    //     This lives here rather than in the instruction stream so that bytecode is unaffected when not collecting.
+    Vector<u32> instruction_slots;
+
+    // Indexed like Executable::property_lookup_caches.
+    Vector<InstructionFeedback> property_lookups;
+};
+
+ObservedTypes observed_type_of(Value);
+
+JS_API ExecutableFeedback& feedback_for_executable(Executable&);
+
+// Feedback slot of the currently executing instruction, allocated the first time it records something.
+InstructionFeedback& feedback_for_current_instruction(VM&);
+
+// Called by the shared property access code whenever a property lookup cache is consulted and whenever it misses.
+void record_property_lookup_cache_access(VM&, PropertyLookupCache const&);
+void record_property_lookup_cache_miss(VM&, PropertyLookupCache const&);
+
+// All executables that have been entered while collecting type feedback and are still alive.
+JS_API Vector<GC::Ref<Executable>> executables_with_type_feedback();
+
+// Prints the executables that were entered most often, followed by their polymorphic instructions.
+JS_API void dump_type_feedback(size_t max_number_of_executables);
+
+}
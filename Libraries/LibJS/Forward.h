@@ -221,6 +221,7 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class SamplingProfiler;
 class ScopeNode;
 class Script;
 class Shape;
@@ -2300,6 +2300,9 @@ void Parser::parse_statement_list(ScopeNode& output_node, AllowLabelledFunction
 }
 
 // FunctionBody, https://tc39.es/ecma262/#prod-FunctionBody
+// FIXME: Inner function bodies are always parsed into a full AST, even though most functions in large scripts are never
+//        called. Add a pre-parse mode that only checks syntax and records the scope information and source range of
+//        the function, and parse the body for real when the function is first called.
 NonnullRefPtr<FunctionBody const> Parser::parse_function_body(NonnullRefPtr<FunctionParameters const> parameters, FunctionKind function_kind, FunctionParsingInsights& parsing_insights)
 {
     auto rule_start = push_start();
@@ -9,6 +9,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashTable.h>
+#include <AK/QuickSort.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibJS/Runtime/AbstractOperations.h>
@@ -147,6 +148,90 @@ static ThrowCompletionOr<Object*> array_species_create(VM& vm, Object& original_
     return TRY(construct(vm, constructor.as_function(), Value(length))).ptr();
 }
 
+// OPTIMIZATION: The elements of an Array that is not a proxy target, whose elements are in simple storage and whose
+//               prototype chain has no indexed properties can be read directly from that storage, as HasProperty() and
+//               Get() can have no side effects then. A hole is not present and reads as undefined.
+static SimpleIndexedPropertyStorage const* storage_for_direct_element_access(Object const& object)
+{
+    auto const* array = as_if<Array>(object);
+    if (!array || array->is_proxy_target() || !array->default_prototype_chain_intact())
+        return nullptr;
+    auto const* storage = array->indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    return static_cast<SimpleIndexedPropertyStorage const*>(storage);
+}
+
+// Returns the result of Get(O, Pk) if HasProperty(O, Pk) is true, reading it directly from storage if possible.
+static ThrowCompletionOr<Optional<Value>> get_element_if_present(Object& object, size_t index)
+{
+    if (auto const* storage = storage_for_direct_element_access(object)) {
+        if (index >= storage->array_like_size() || !storage->inline_has_index(index))
+            return Optional<Value> {};
+        return storage->elements()[index];
+    }
+
+    auto property_key = PropertyKey { index };
+    if (!TRY(object.has_property(property_key)))
+        return Optional<Value> {};
+    return TRY(object.get(property_key));
+}
+
+// OPTIMIZATION: Without a comparefn, elements are sorted by their string representations. For numbers, ToString() has no
+//               side effects, so we can convert each element once instead of for every comparison.
+static Optional<GC::RootVector<Value>> sort_number_elements_without_comparefn(VM& vm, Object const& object, size_t length, Holes holes)
+{
+    auto const* storage = storage_for_direct_element_access(object);
+    if (!storage || !is_number_elements_kind(storage->elements_kind()) || storage->array_like_size() != length)
+        return {};
+
+    struct Item {
+        Value value;
+        String string;
+        size_t index;
+    };
+    Vector<Item> items;
+    items.ensure_capacity(length);
+    size_t hole_count = 0;
+    for (size_t k = 0; k < length; ++k) {
+        auto value = storage->elements()[k];
+        if (value.is_special_empty_value()) {
+            ++hole_count;
+            continue;
+        }
+        items.unchecked_append({ value, MUST(value.to_string(vm)), k });
+    }
+
+    // NB: The string representations of numbers are ASCII, so comparing their bytes is the same as comparing their code
+    //     units. Comparing the original indices of equal strings keeps the sort stable.
+    quick_sort(items, [](auto const& a, auto const& b) {
+        if (auto result = a.string.bytes_as_string_view().compare(b.string.bytes_as_string_view()); result != 0)
+            return result < 0;
+        return a.index < b.index;
+    });
+
+    GC::RootVector<Value> sorted_list { vm.heap() };
+    sorted_list.ensure_capacity(length);
+    for (auto const& item : items)
+        sorted_list.append(item.value);
+
+    // NB: Holes read as undefined, which is sorted after every other value.
+    if (holes == Holes::ReadThroughHoles) {
+        for (size_t i = 0; i < hole_count; ++i)
+            sorted_list.append(js_undefined());
+    }
+    return sorted_list;
+}
+
+static ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties_of_object(VM& vm, Object const& object, size_t length, Value comparefn, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
+{
+    if (comparefn.is_undefined()) {
+        if (auto sorted_list = sort_number_elements_without_comparefn(vm, object, length, holes); sorted_list.has_value())
+            return sorted_list.release_value();
+    }
+    return sort_indexed_properties(vm, object, length, sort_compare, holes);
+}
+
 // 23.1.3.1 Array.prototype.at ( index ), https://tc39.es/ecma262/#sec-array.prototype.at
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::at)
 {
@@ -744,6 +829,23 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    if (auto const* storage = storage_for_direct_element_access(*this_object)) {
+        // NB: An array of numbers can only include other numbers, or undefined if some of it reads through holes.
+        if (is_number_elements_kind(storage->elements_kind()) && !value_to_find.is_number() && !value_to_find.is_undefined())
+            return Value(false);
+
+        auto const& elements = storage->elements();
+        for (u64 i = from_index; i < length; ++i) {
+            auto element = i < storage->array_like_size() ? elements[i] : js_undefined();
+            if (element.is_special_empty_value())
+                element = js_undefined();
+            if (same_value_zero(element, value_to_find))
+                return Value(true);
+        }
+        return Value(false);
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -797,6 +899,31 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    if (auto const* storage = storage_for_direct_element_access(*object)) {
+        auto kind = storage->elements_kind();
+        auto const& elements = storage->elements();
+        auto end = min(length, storage->array_like_size());
+
+        // NB: Nothing but a number can be strictly equal to an element of an array of numbers.
+        if (is_number_elements_kind(kind) && !search_element.is_number())
+            return Value(-1);
+
+        if (is_int32_elements_kind(kind) && search_element.is_int32()) {
+            auto search_int32 = search_element.as_i32();
+            for (; k < end; ++k) {
+                if (elements[k].is_int32() && elements[k].as_i32() == search_int32)
+                    return Value(k);
+            }
+            return Value(-1);
+        }
+
+        for (; k < end; ++k) {
+            if (!elements[k].is_special_empty_value() && is_strictly_equal(search_element, elements[k]))
+                return Value(k);
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -908,6 +1035,21 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::last_index_of)
         k = (double)length + n;
     }
 
+    if (auto const* storage = storage_for_direct_element_access(*object)) {
+        auto const& elements = storage->elements();
+        k = min(k, static_cast<ssize_t>(storage->array_like_size()) - 1);
+
+        // NB: Nothing but a number can be strictly equal to an element of an array of numbers.
+        if (is_number_elements_kind(storage->elements_kind()) && !search_element.is_number())
+            return Value(-1);
+
+        for (; k >= 0; --k) {
+            if (!elements[k].is_special_empty_value() && is_strictly_equal(search_element, elements[k]))
+                return Value((size_t)k);
+        }
+        return Value(-1);
+    }
+
     // 8. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         auto property_key = PropertyKey { k };
@@ -961,15 +1103,12 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
         auto property_key = PropertyKey { k };
 
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
-
         // c. If kPresent is true, then
-        if (k_present) {
-            // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
-
+        //     i. Let kValue be ? Get(O, Pk).
+        // NB: The callback may change the array, so this has to be checked for every element.
+        if (auto k_value = TRY(get_element_if_present(*object, k)); k_value.has_value()) {
             // ii. Let mappedValue be ? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »).
-            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object));
+            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, *k_value, Value(k), object));
 
             // iii. Perform ? CreateDataPropertyOrThrow(A, Pk, mappedValue).
             TRY(array->create_data_property_or_throw(property_key, mapped_value));
@@ -1007,6 +1146,21 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
     auto new_length = length + argument_count;
     if (new_length > MAX_ARRAY_LIKE_INDEX)
         return vm.throw_completion<TypeError>(ErrorType::ArrayMaxSize);
+
+    // OPTIMIZATION: If this object is an Array that:
+    // - is not a proxy target, which means set will not trap.
+    // - has intact prototype chain, which means there are no setters for the new indices.
+    // - is extensible and has a writable length, which means the new elements can be added.
+    // - has simple storage type (or no storage yet), which means appending keeps default attributes for all values.
+    // then we can append the new elements directly to the indexed storage, which also updates the length.
+    if (auto* array = as_if<Array>(*this_object); array && !array->is_proxy_target() && array->default_prototype_chain_intact() && array->length_is_writable() && TRY(array->is_extensible())) {
+        if (auto const* storage = array->indexed_properties().storage(); !storage || storage->is_simple_storage()) {
+            for (size_t i = 0; i < argument_count; ++i)
+                array->indexed_properties().append(vm.argument(i));
+            return Value(new_length);
+        }
+    }
+
     for (size_t i = 0; i < argument_count; ++i)
         TRY(this_object->set(length + i, vm.argument(i), Object::ShouldThrowExceptions::Yes));
     auto new_length_value = Value(new_length);
@@ -1431,7 +1585,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     };
 
     // 5. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, skip-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles));
+    auto sorted_list = TRY(sort_indexed_properties_of_object(vm, *object, length, comparefn, sort_compare, Holes::SkipHoles));
 
     // 6. Let itemCount be the number of elements in sortedList.
     auto item_count = sorted_list.size();
@@ -1739,7 +1893,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::to_sorted)
     };
 
     // 6. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, read-through-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles));
+    auto sorted_list = TRY(sort_indexed_properties_of_object(vm, *object, length, comparefn, sort_compare, Holes::ReadThroughHoles));
 
     // 7. Let j be 0.
     // 8. Repeat, while j < len,
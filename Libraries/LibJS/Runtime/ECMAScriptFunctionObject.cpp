@@ -217,6 +217,9 @@ void ECMAScriptFunctionObject::get_stack_frame_size(size_t& registers_and_locals
 {
     auto& executable = shared_data().m_executable;
     if (!executable) {
+        // NB: Module wrappers are compiled from their AST directly, but their function environment requirements are
+        //     still consulted when they are called.
+        m_shared_data->ensure_function_declaration_instantiation_data(vm());
         if (is_module_wrapper()) {
             executable = Bytecode::compile(vm(), ecmascript_code(), kind(), name());
         } else {
@@ -274,6 +277,32 @@ FLATTEN ThrowCompletionOr<Value> ECMAScriptFunctionObject::internal_call(Executi
     return result;
 }
 
+// NB: This is [[Call]] for a function that is known to satisfy can_be_cached_at_call_site(), so steps 4 and 6 are simplified.
+FLATTEN ThrowCompletionOr<Value> ECMAScriptFunctionObject::internal_call_from_call_site_cache(ExecutionContext& callee_context, Value this_argument)
+{
+    auto& vm = this->vm();
+
+    ASSERT(can_be_cached_at_call_site());
+
+    // 2. Let calleeContext be PrepareForOrdinaryCall(F, undefined).
+    prepare_for_ordinary_call(vm, callee_context, nullptr);
+
+    // 5. Perform OrdinaryCallBindThis(F, calleeContext, thisArgument).
+    if (uses_this())
+        ordinary_call_bind_this(vm, callee_context, this_argument);
+
+    // 6. Let result be Completion(OrdinaryCallEvaluateBody(F, argumentsList)).
+    auto result = vm.bytecode_interpreter().run_executable(callee_context, *bytecode_executable(), {});
+
+    // 7. Remove calleeContext from the execution context stack and restore callerContext as the running execution context.
+    vm.pop_execution_context();
+
+    // 8. If result.[[Type]] is return, return result.[[Value]].
+    // 9. Assert: result is a throw completion.
+    // 10. Return ? result.
+    return result;
+}
+
 // 10.2.2 [[Construct]] ( argumentsList, newTarget ), https://tc39.es/ecma262/#sec-ecmascript-function-objects-construct-argumentslist-newtarget
 FLATTEN ThrowCompletionOr<GC::Ref<Object>> ECMAScriptFunctionObject::internal_construct(ExecutionContext& callee_context, FunctionObject& new_target)
 {
@@ -54,6 +54,12 @@ public:
     virtual ThrowCompletionOr<Value> internal_call(ExecutionContext&, Value this_argument) override;
     virtual ThrowCompletionOr<GC::Ref<Object>> internal_construct(ExecutionContext&, FunctionObject& new_target) override;
 
+    // Calls to functions that are normal (not generators, async functions or class constructors) and have already been
+    // compiled can be cached at the call site. The bytecode interpreter then calls them via internal_call_from_call_site_cache(),
+    // which skips the checks that were performed when the callee was cached.
+    [[nodiscard]] bool can_be_cached_at_call_site() const { return kind() == FunctionKind::Normal && !is_class_constructor() && bytecode_executable(); }
+    ThrowCompletionOr<Value> internal_call_from_call_site_cache(ExecutionContext&, Value this_argument);
+
     void make_method(Object& home_object);
 
     [[nodiscard]] bool is_module_wrapper() const { return shared_data().m_is_module_wrapper; }
@@ -29,6 +29,33 @@ class IndexedProperties;
 class IndexedPropertyIterator;
 class GenericIndexedPropertyStorage;
 
+// What the elements of a SimpleIndexedPropertyStorage are known to be, so that code accessing them can skip checks that
+// can't fail. The kind of values only ever becomes more general, while an array is holey as long as it has any holes.
+enum class ElementsKind : u8 {
+    PackedInt32,
+    PackedDouble,
+    PackedElements,
+    HoleyInt32,
+    HoleyDouble,
+    HoleyElements,
+};
+
+constexpr bool is_packed_elements_kind(ElementsKind kind)
+{
+    return kind <= ElementsKind::PackedElements;
+}
+
+constexpr bool is_int32_elements_kind(ElementsKind kind)
+{
+    return kind == ElementsKind::PackedInt32 || kind == ElementsKind::HoleyInt32;
+}
+
+// Int32 elements are numbers too, so this is also true for those.
+constexpr bool is_number_elements_kind(ElementsKind kind)
+{
+    return kind != ElementsKind::PackedElements && kind != ElementsKind::HoleyElements;
+}
+
 class IndexedPropertyStorage {
 public:
     virtual ~IndexedPropertyStorage() = default;
@@ -105,15 +132,50 @@ public:
         return ValueAndAttributes { m_packed_elements.data()[index], default_attributes };
     }
 
+    // Replaces an element that is known to be present, skipping the bookkeeping for holes.
+    void inline_put_existing(u32 index, Value value)
+    {
+        VERIFY(inline_has_index(index));
+        VERIFY(!value.is_special_empty_value());
+        m_packed_elements.data()[index] = value;
+        update_value_kind(value);
+    }
+
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    [[nodiscard]] ElementsKind elements_kind() const
+    {
+        auto value_kind = to_underlying(m_value_kind);
+        if (has_empty_elements())
+            return static_cast<ElementsKind>(value_kind + to_underlying(ElementsKind::HoleyInt32));
+        return static_cast<ElementsKind>(value_kind);
+    }
+
 private:
     friend GenericIndexedPropertyStorage;
 
+    // NB: These line up with the packed elements kinds.
+    enum class ValueKind : u8 {
+        Int32,
+        Double,
+        Any,
+    };
+
+    void update_value_kind(Value value)
+    {
+        if (m_value_kind == ValueKind::Any || value.is_int32())
+            return;
+        if (value.is_number())
+            m_value_kind = ValueKind::Double;
+        else if (!value.is_special_empty_value())
+            m_value_kind = ValueKind::Any;
+    }
+
     void grow_storage_if_needed();
 
     Checked<size_t> m_number_of_empty_elements { 0 };
     Vector<Value> m_packed_elements;
+    ValueKind m_value_kind { ValueKind::Int32 };
 };
 
 class GenericIndexedPropertyStorage final : public IndexedPropertyStorage {
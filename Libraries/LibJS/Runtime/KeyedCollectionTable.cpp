@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/KeyedCollectionTable.h>
+#include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/Runtime/ValueTraits.h>
+
+namespace JS {
+
+Optional<Value> KeyedCollectionTable::get(Value key) const
+{
+    if (auto index = find_slot(key); index.has_value())
+        return m_slots[*index].entry.value;
+    return {};
+}
+
+void KeyedCollectionTable::set(Value key, Value value)
+{
+    auto hash = ValueTraits::hash(key);
+
+    if (auto index = find_slot(key, hash); index.has_value()) {
+        m_slots[*index].entry.value = value;
+        return;
+    }
+
+    if (m_slots.size() == slot_capacity()) {
+        // Only grow if the live entries take up at least half of the table, otherwise dropping the tombstones makes
+        // enough room.
+        auto bucket_count = max(m_buckets.size(), minimum_bucket_count);
+        if (m_size * slots_per_bucket >= slot_capacity())
+            bucket_count = m_buckets.is_empty() ? minimum_bucket_count : m_buckets.size() * 2;
+        rehash(bucket_count);
+    }
+
+    auto& bucket = m_buckets[bucket_index(hash)];
+    m_slots.append({ .entry = { key, value }, .insertion_id = m_next_insertion_id++, .next_in_chain = bucket });
+    bucket = static_cast<u32>(m_slots.size() - 1);
+    ++m_size;
+}
+
+bool KeyedCollectionTable::remove(Value key)
+{
+    auto index = find_slot(key);
+    if (!index.has_value())
+        return false;
+
+    // NOTE: The slot stays in its chain, lookups skip over tombstones.
+    m_slots[*index].entry = { js_special_empty_value(), js_special_empty_value() };
+    --m_size;
+
+    // Give memory back once the table has become mostly empty.
+    if (m_buckets.size() > minimum_bucket_count && m_size * slots_per_bucket * 4 <= slot_capacity())
+        rehash(m_buckets.size() / 2);
+
+    return true;
+}
+
+void KeyedCollectionTable::clear()
+{
+    m_slots.clear();
+    m_buckets.clear();
+    m_size = 0;
+    ++m_generation;
+}
+
+Optional<u32> KeyedCollectionTable::find_slot(Value key) const
+{
+    if (m_size == 0)
+        return {};
+    return find_slot(key, ValueTraits::hash(key));
+}
+
+Optional<u32> KeyedCollectionTable::find_slot(Value key, unsigned hash) const
+{
+    if (m_buckets.is_empty())
+        return {};
+
+    for (auto index = m_buckets[bucket_index(hash)]; index != no_slot; index = m_slots[index].next_in_chain) {
+        auto const& slot = m_slots[index];
+        if (!is_tombstone(slot) && ValueTraits::equals(slot.entry.key, key))
+            return index;
+    }
+    return {};
+}
+
+void KeyedCollectionTable::rehash(size_t bucket_count)
+{
+    VERIFY(is_power_of_two(bucket_count));
+    VERIFY(bucket_count * slots_per_bucket < no_slot);
+
+    Vector<Slot> slots;
+    slots.ensure_capacity(bucket_count * slots_per_bucket);
+
+    Vector<u32> buckets;
+    buckets.resize(bucket_count);
+    buckets.fill(no_slot);
+
+    for (auto const& slot : m_slots) {
+        if (is_tombstone(slot))
+            continue;
+        auto& bucket = buckets[ValueTraits::hash(slot.entry.key) & (bucket_count - 1)];
+        slots.unchecked_append({ .entry = slot.entry, .insertion_id = slot.insertion_id, .next_in_chain = bucket });
+        bucket = static_cast<u32>(slots.size() - 1);
+    }
+
+    // Dropping tombstones moves the remaining slots, so existing cursors have to find their position again.
+    if (slots.size() != m_slots.size())
+        ++m_generation;
+
+    m_slots = move(slots);
+    m_buckets = move(buckets);
+}
+
+bool KeyedCollectionTable::seek(Cursor& cursor) const
+{
+    if (cursor.generation != m_generation) {
+        // Find the first slot whose insertion id is not below the cursor's, i.e. the first entry it has not visited.
+        size_t low = 0;
+        size_t high = m_slots.size();
+        while (low < high) {
+            auto middle = low + (high - low) / 2;
+            if (m_slots[middle].insertion_id < cursor.insertion_id)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        cursor.index = low;
+        cursor.generation = m_generation;
+    }
+
+    for (; cursor.index < m_slots.size(); ++cursor.index) {
+        auto const& slot = m_slots[cursor.index];
+        if (!is_tombstone(slot)) {
+            cursor.insertion_id = slot.insertion_id;
+            return true;
+        }
+    }
+
+    // Every entry has been visited. Entries added from now on have an insertion id of at least m_next_insertion_id.
+    cursor.insertion_id = m_next_insertion_id;
+    return false;
+}
+
+void KeyedCollectionTable::advance(Cursor& cursor) const
+{
+    if (!seek(cursor))
+        return;
+    ++cursor.index;
+    ++cursor.insertion_id;
+}
+
+void KeyedCollectionTable::visit_edges(Cell::Visitor& visitor)
+{
+    for (auto& slot : m_slots) {
+        visitor.visit(slot.entry.key);
+        visitor.visit(slot.entry.value);
+    }
+}
+
+}
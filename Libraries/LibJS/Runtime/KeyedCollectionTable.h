@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NumericLimits.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Export.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS {
+
+// A deterministic hash table (as described by Tyler Close) backing the [[MapData]] and [[SetData]] internal slots.
+// Entries are stored densely in insertion order, and a separate bucket table chains them by hash. Removing an entry
+// leaves a tombstone behind, which keeps the position of every other entry (and thus every live iterator) intact.
+// Tombstones are dropped when the table is rehashed.
+class JS_API KeyedCollectionTable {
+public:
+    struct Entry {
+        Value key;
+        Value value;
+    };
+
+private:
+    static constexpr u32 no_slot = NumericLimits<u32>::max();
+    static constexpr size_t minimum_bucket_count = 4;
+    static constexpr size_t slots_per_bucket = 2;
+
+    struct Slot {
+        Entry entry;
+        size_t insertion_id { 0 };
+        u32 next_in_chain { no_slot };
+    };
+
+    // The position of an iterator. Slot indices change whenever tombstones are dropped, but insertion ids are strictly
+    // increasing along the slot array, so a cursor from an older generation can find where to continue.
+    struct Cursor {
+        size_t index { 0 };
+        size_t insertion_id { 0 };
+        size_t generation { 0 };
+    };
+
+public:
+    struct EndIterator {
+    };
+
+    class Iterator {
+    public:
+        bool is_end() const { return !m_table->seek(m_cursor); }
+
+        Iterator& operator++()
+        {
+            m_table->advance(m_cursor);
+            return *this;
+        }
+
+        Entry const& operator*() const
+        {
+            auto found = m_table->seek(m_cursor);
+            VERIFY(found);
+            return m_table->m_slots[m_cursor.index].entry;
+        }
+
+        bool operator==(EndIterator const&) const { return is_end(); }
+
+        void visit_edges(Cell::Visitor& visitor)
+        {
+            visitor.visit(m_owner);
+        }
+
+    private:
+        friend class KeyedCollectionTable;
+
+        Iterator(Cell const& owner, KeyedCollectionTable const& table)
+            : m_owner(owner)
+            , m_table(&table)
+        {
+            m_cursor.generation = table.m_generation;
+        }
+
+        // NOTE: The table is a member of the owning cell, so keeping the owner alive keeps the table alive.
+        GC::Ref<Cell const> m_owner;
+        KeyedCollectionTable const* m_table { nullptr };
+        mutable Cursor m_cursor;
+    };
+
+    Optional<Value> get(Value key) const;
+    bool contains(Value key) const { return find_slot(key).has_value(); }
+    void set(Value key, Value value);
+    bool remove(Value key);
+    void clear();
+
+    size_t size() const { return m_size; }
+
+    Iterator begin(Cell const& owner) const { return { owner, *this }; }
+    EndIterator end() const { return {}; }
+
+    void visit_edges(Cell::Visitor&);
+
+private:
+    static bool is_tombstone(Slot const& slot) { return slot.entry.key.is_special_empty_value(); }
+
+    Optional<u32> find_slot(Value key) const;
+    Optional<u32> find_slot(Value key, unsigned hash) const;
+    size_t bucket_index(unsigned hash) const { return hash & (m_buckets.size() - 1); }
+    size_t slot_capacity() const { return m_buckets.size() * slots_per_bucket; }
+
+    void rehash(size_t bucket_count);
+
+    bool seek(Cursor&) const;
+    void advance(Cursor&) const;
+
+    Vector<Slot> m_slots;
+    Vector<u32> m_buckets;
+    size_t m_size { 0 };
+    size_t m_next_insertion_id { 0 };
+
+    // Incremented whenever slots move, i.e. when tombstones are dropped or the table is cleared.
+    size_t m_generation { 0 };
+};
+
+}
@@ -11,6 +11,7 @@
 #include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/Map.h>
 #include <LibJS/Runtime/MapConstructor.h>
+#include <LibJS/Runtime/ValueTraits.h>
 
 namespace JS {
 
@@ -114,7 +114,7 @@ JS_DEFINE_NATIVE_FUNCTION(MapPrototype::for_each)
         // i. Let e be entries[index].
         // b. Set index to index + 1.
         // c. If e.[[Key]] is not empty, then
-        // NOTE: This is handled by Map's IteratorImpl.
+        // NOTE: This is handled by KeyedCollectionTable::Iterator.
 
         // i. Perform ? Call(callbackfn, thisArg, « e.[[Value]], e.[[Key]], M »).
         TRY(call(vm, callbackfn.as_function(), this_arg, entry.value, entry.key, map));
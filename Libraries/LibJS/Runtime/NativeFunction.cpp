@@ -10,6 +10,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/NativeJavaScriptBackedFunction.h>
 #include <LibJS/Runtime/Realm.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/Value.h>
 
 namespace JS {
@@ -154,6 +155,11 @@ ThrowCompletionOr<Value> NativeFunction::internal_call(ExecutionContext& callee_
     // 10. Let result be the Completion Record that is the result of evaluating F in a manner that conforms to the specification of F. thisArgument is the this value, argumentsList provides the named parameters, and the NewTarget value is undefined.
     auto result = call();
 
+    // NB: The sampling profiler can't sample while native code runs, so a sample that came due in the meantime is
+    //     taken while this function is still the running execution context, instead of being charged to the caller.
+    if (g_sampling_profiler_sample_requested.load(AK::MemoryOrder::memory_order_relaxed)) [[unlikely]]
+        vm.sampling_profiler().take_sample();
+
     // 11. Remove calleeContext from the execution context stack and restore callerContext as the running execution context.
     vm.pop_execution_context();
 
@@ -205,6 +211,9 @@ ThrowCompletionOr<GC::Ref<Object>> NativeFunction::internal_construct(ExecutionC
     // 10. Let result be the Completion Record that is the result of evaluating F in a manner that conforms to the specification of F. The this value is uninitialized, argumentsList provides the named parameters, and newTarget provides the NewTarget value.
     auto result = construct(new_target);
 
+    if (g_sampling_profiler_sample_requested.load(AK::MemoryOrder::memory_order_relaxed)) [[unlikely]]
+        vm.sampling_profiler().take_sample();
+
     // 11. Remove calleeContext from the execution context stack and restore callerContext as the running execution context.
     vm.pop_execution_context();
 
@@ -34,6 +34,10 @@ GC::Ref<NativeJavaScriptBackedFunction> NativeJavaScriptBackedFunction::create(R
     // 9. Set func.[[InitialName]] to null.
     auto function = realm.create<NativeJavaScriptBackedFunction>(shared_data, *prototype);
 
+    // NB: [[Call]] consults the function environment requirements before compiling the function, so these must be
+    //     computed up front.
+    shared_data->ensure_function_declaration_instantiation_data(realm.vm());
+
     function->unsafe_set_shape(realm.intrinsics().native_function_shape());
 
     // 10. Perform SetFunctionLength(func, length).
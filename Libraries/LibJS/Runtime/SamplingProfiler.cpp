@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/JsonArray.h>
+#include <LibCore/System.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/SourceCode.h>
+#include <LibThreading/Thread.h>
+
+namespace JS {
+
+Atomic<bool> g_sampling_profiler_sample_requested { false };
+
+SamplingProfiler::SamplingProfiler(VM& vm)
+    : m_vm(vm)
+{
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+// NB: Frame 0 belongs to the root of the call tree, frame 1 to execution contexts without a function, and
+//     frame 2 to the time in which no JavaScript was running.
+static constexpr size_t ROOT_FRAME = 0;
+static constexpr size_t ANONYMOUS_FRAME = 1;
+static constexpr size_t IDLE_FRAME = 2;
+
+void SamplingProfiler::start(AK::Duration sampling_interval)
+{
+    if (m_running)
+        return;
+
+    m_frames.clear();
+    m_nodes.clear();
+    m_samples.clear();
+    m_frames.append({ .function_name = "(root)"_utf16 });
+    m_frames.append(Frame {});
+    m_frames.append({ .function_name = "(idle)"_utf16 });
+    m_nodes.append({ .frame = ROOT_FRAME });
+
+    m_start_wall_time = UnixDateTime::now();
+    m_start_time = MonotonicTime::now();
+    m_sampling_interval = sampling_interval;
+    m_running = true;
+    m_should_stop.store(false);
+    m_pending_ticks.store(0);
+    m_pending_idle_ticks.store(0);
+    m_is_running_javascript.store(m_vm.bytecode_interpreter().is_running());
+
+    auto sampling_interval_in_milliseconds = static_cast<u32>(max<i64>(1, sampling_interval.to_milliseconds()));
+    m_timer_thread = Threading::Thread::construct("JS Sampler"sv, [this, sampling_interval_in_milliseconds]() -> intptr_t {
+        while (!m_should_stop.load()) {
+            (void)Core::System::sleep_ms(sampling_interval_in_milliseconds);
+            if (!m_is_running_javascript.load(AK::MemoryOrder::memory_order_relaxed)) {
+                m_pending_idle_ticks.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+                continue;
+            }
+            m_pending_ticks.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+            g_sampling_profiler_sample_requested.store(true, AK::MemoryOrder::memory_order_relaxed);
+        }
+        return 0;
+    });
+    m_timer_thread->start();
+}
+
+void SamplingProfiler::stop()
+{
+    if (!m_running)
+        return;
+
+    m_should_stop.store(true);
+    (void)m_timer_thread->join();
+    m_timer_thread = nullptr;
+
+    if (!m_is_running_javascript.load())
+        record_idle_ticks();
+    else if (m_pending_ticks.load(AK::MemoryOrder::memory_order_relaxed) > 0)
+        take_sample();
+
+    g_sampling_profiler_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+    m_running = false;
+    m_end_time = MonotonicTime::now();
+
+    // NB: Frames keep their own reference to their source code, so the functions themselves can be released now.
+    m_frame_for_executable.clear();
+    m_frame_for_native_function.clear();
+    m_executable_roots.clear();
+    m_native_function_roots.clear();
+}
+
+size_t SamplingProfiler::frame_for(ExecutionContext const& context)
+{
+    if (auto const* executable = context.executable.ptr()) {
+        if (auto it = m_frame_for_executable.find(executable); it != m_frame_for_executable.end())
+            return it->value;
+
+        Frame frame { .source_code = executable->source_code };
+        if (context.function)
+            frame.function_name = context.function->name_for_call_stack();
+        if (auto range = executable->source_range_at(0); range.source_code)
+            frame.source_offset = range.start_offset;
+
+        auto index = m_frames.size();
+        m_frames.append(move(frame));
+        m_frame_for_executable.set(executable, index);
+        m_executable_roots.append(GC::make_root(*context.executable));
+        return index;
+    }
+
+    auto const* function = context.function.ptr();
+    if (!function)
+        return ANONYMOUS_FRAME;
+
+    if (auto it = m_frame_for_native_function.find(function); it != m_frame_for_native_function.end())
+        return it->value;
+
+    auto index = m_frames.size();
+    m_frames.append({ .function_name = function->name_for_call_stack() });
+    m_frame_for_native_function.set(function, index);
+    m_native_function_roots.append(GC::make_root(*context.function));
+    return index;
+}
+
+size_t SamplingProfiler::child_node(size_t parent, size_t frame)
+{
+    for (auto child : m_nodes[parent].children) {
+        if (m_nodes[child].frame == frame)
+            return child;
+    }
+
+    auto child = m_nodes.size();
+    m_nodes.append({ .frame = frame, .parent = parent });
+    m_nodes[parent].children.append(child);
+    return child;
+}
+
+void SamplingProfiler::take_sample()
+{
+    g_sampling_profiler_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+    if (!m_running)
+        return;
+
+    // NB: If the VM was not at a safe point for several ticks (e.g. while running native code), this one sample
+    //     stands in for all of them.
+    auto weight = max(1u, m_pending_ticks.exchange(0, AK::MemoryOrder::memory_order_relaxed));
+
+    auto const& execution_context_stack = m_vm.execution_context_stack();
+
+    size_t node = 0;
+    for (auto const* context : execution_context_stack)
+        node = child_node(node, frame_for(*context));
+    m_nodes[node].hit_count += weight;
+
+    if (!execution_context_stack.is_empty()) {
+        auto const& context = *execution_context_stack.last();
+        if (context.executable) {
+            auto range = context.executable->source_range_at(context.program_counter);
+            if (range.source_code)
+                m_nodes[node].source_offset_ticks.ensure(range.start_offset) += weight;
+        }
+    }
+
+    m_samples.append({ .node = node, .weight = weight, .time = MonotonicTime::now() });
+}
+
+void SamplingProfiler::did_start_running_javascript()
+{
+    record_idle_ticks();
+    m_is_running_javascript.store(true);
+}
+
+void SamplingProfiler::will_stop_running_javascript()
+{
+    // NB: Ticks that fired while JavaScript was running belong to the stack that is still running.
+    if (m_pending_ticks.load(AK::MemoryOrder::memory_order_relaxed) > 0)
+        take_sample();
+    m_is_running_javascript.store(false);
+}
+
+void SamplingProfiler::record_idle_ticks()
+{
+    g_sampling_profiler_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+
+    // NB: A tick that raced with JavaScript stopping is counted as a regular tick, but it can't belong to the next
+    //     stack that runs either, so it is idle time as well.
+    auto weight = m_pending_idle_ticks.exchange(0, AK::MemoryOrder::memory_order_relaxed) + m_pending_ticks.exchange(0, AK::MemoryOrder::memory_order_relaxed);
+    if (weight == 0)
+        return;
+
+    auto node = child_node(0, IDLE_FRAME);
+    m_nodes[node].hit_count += weight;
+    m_samples.append({ .node = node, .weight = weight, .time = MonotonicTime::now() });
+}
+
+// NB: Positions are one-based here, each export format adjusts them as needed.
+Vector<Optional<SamplingProfiler::FramePosition>> SamplingProfiler::realize_frame_positions() const
+{
+    Vector<Optional<FramePosition>> positions;
+    positions.ensure_capacity(m_frames.size());
+    for (auto const& frame : m_frames) {
+        if (!frame.source_code) {
+            positions.unchecked_append(OptionalNone {});
+            continue;
+        }
+        auto position = frame.source_code->range_from_offsets(frame.source_offset, frame.source_offset).start;
+        positions.unchecked_append(FramePosition {
+            .url = frame.source_code->filename(),
+            .line = static_cast<i32>(position.line),
+            .column = static_cast<i32>(position.column),
+        });
+    }
+    return positions;
+}
+
+JsonObject SamplingProfiler::to_cpuprofile() const
+{
+    auto frame_positions = realize_frame_positions();
+
+    JsonArray nodes;
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        auto const& node = m_nodes[i];
+        auto const& frame = m_frames[node.frame];
+        auto const& position = frame_positions[node.frame];
+
+        // NB: Positions in the .cpuprofile format are zero-based.
+        JsonObject call_frame;
+        call_frame.set("functionName"sv, frame.function_name.to_utf8());
+        call_frame.set("scriptId"sv, "0"sv);
+        call_frame.set("url"sv, position.has_value() ? position->url : String {});
+        call_frame.set("lineNumber"sv, position.has_value() ? position->line - 1 : -1);
+        call_frame.set("columnNumber"sv, position.has_value() ? position->column - 1 : -1);
+
+        // NB: Node IDs in the .cpuprofile format start at 1.
+        JsonObject json_node;
+        json_node.set("id"sv, i + 1);
+        json_node.set("callFrame"sv, move(call_frame));
+        json_node.set("hitCount"sv, node.hit_count);
+
+        if (!node.children.is_empty()) {
+            JsonArray children;
+            for (auto child : node.children)
+                children.must_append(child + 1);
+            json_node.set("children"sv, move(children));
+        }
+
+        if (!node.source_offset_ticks.is_empty()) {
+            HashMap<u32, u32> line_ticks;
+            for (auto const& it : node.source_offset_ticks) {
+                auto line = frame.source_code->range_from_offsets(it.key, it.key).start.line;
+                line_ticks.ensure(line) += it.value;
+            }
+
+            JsonArray position_ticks;
+            for (auto const& it : line_ticks) {
+                JsonObject position_tick;
+                position_tick.set("line"sv, it.key);
+                position_tick.set("ticks"sv, it.value);
+                position_ticks.must_append(move(position_tick));
+            }
+            json_node.set("positionTicks"sv, move(position_ticks));
+        }
+
+        nodes.must_append(move(json_node));
+    }
+
+    JsonArray samples;
+    JsonArray time_deltas;
+    auto last_sample_time = m_start_time;
+    for (auto const& sample : m_samples) {
+        samples.must_append(sample.node + 1);
+        time_deltas.must_append((sample.time - last_sample_time).to_microseconds());
+        last_sample_time = sample.time;
+    }
+
+    auto end_time = m_running ? MonotonicTime::now() : m_end_time;
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, m_start_time.nanoseconds() / 1000);
+    profile.set("endTime"sv, end_time.nanoseconds() / 1000);
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+    return profile;
+}
+
+static JsonObject gecko_schema(ReadonlySpan<StringView> fields)
+{
+    JsonObject schema;
+    for (size_t i = 0; i < fields.size(); ++i)
+        schema.set(fields[i], i);
+    return schema;
+}
+
+static JsonObject gecko_table(ReadonlySpan<StringView> fields, JsonArray data)
+{
+    JsonObject table;
+    table.set("schema"sv, gecko_schema(fields));
+    table.set("data"sv, move(data));
+    return table;
+}
+
+JsonObject SamplingProfiler::to_gecko_profile() const
+{
+    auto frame_positions = realize_frame_positions();
+    auto milliseconds_since_start = [&](MonotonicTime time) {
+        return static_cast<double>((time - m_start_time).to_microseconds()) / 1000.0;
+    };
+
+    JsonArray string_table;
+
+    // NB: The root of the call tree is not a frame of its own in the Gecko format, so frame N is stored at index N - 1.
+    JsonArray frame_table;
+    for (size_t i = ROOT_FRAME + 1; i < m_frames.size(); ++i) {
+        auto const& position = frame_positions[i];
+
+        auto function_name = m_frames[i].function_name.is_empty() ? "(anonymous)"_string : m_frames[i].function_name.to_utf8();
+        auto location = position.has_value()
+            ? MUST(String::formatted("{} ({}:{}:{})", function_name, position->url, position->line, position->column))
+            : function_name;
+        string_table.must_append(move(location));
+
+        // NB: The order of the fields follows the frame table schema below.
+        JsonArray frame;
+        frame.must_append(string_table.size() - 1);
+        frame.must_append(false);
+        frame.must_append(0);
+        frame.must_append(JsonValue {});
+        frame.must_append(position.has_value() ? JsonValue { position->line } : JsonValue {});
+        frame.must_append(position.has_value() ? JsonValue { position->column } : JsonValue {});
+        frame.must_append(0);
+        frame.must_append(0);
+        frame_table.must_append(move(frame));
+    }
+
+    // NB: Every node but the root is a stack, so node N is stored at index N - 1 as well.
+    JsonArray stack_table;
+    for (size_t i = 1; i < m_nodes.size(); ++i) {
+        auto const& node = m_nodes[i];
+
+        JsonArray stack;
+        stack.must_append(node.parent == 0 ? JsonValue {} : JsonValue { node.parent - 1 });
+        stack.must_append(node.frame - 1);
+        stack_table.must_append(move(stack));
+    }
+
+    // NB: The Gecko format has no sample weights, so a sample that covers several ticks is spread out over them.
+    JsonArray samples;
+    auto last_sample_time = m_start_time;
+    for (auto const& sample : m_samples) {
+        auto stack = sample.node == 0 ? JsonValue {} : JsonValue { sample.node - 1 };
+        auto last_sample_milliseconds = milliseconds_since_start(last_sample_time);
+        auto interval_in_milliseconds = (milliseconds_since_start(sample.time) - last_sample_milliseconds) / sample.weight;
+        for (u32 i = 1; i <= sample.weight; ++i) {
+            JsonArray row;
+            row.must_append(stack);
+            row.must_append(last_sample_milliseconds + interval_in_milliseconds * i);
+            row.must_append(0);
+            samples.must_append(move(row));
+        }
+        last_sample_time = sample.time;
+    }
+
+    auto end_time = m_running ? MonotonicTime::now() : m_end_time;
+
+    JsonObject thread;
+    thread.set("name"sv, "GeckoMain"sv);
+    thread.set("processType"sv, "default"sv);
+    thread.set("processName"sv, "JavaScript"sv);
+    thread.set("pid"sv, Core::System::getpid());
+    thread.set("tid"sv, Core::System::getpid());
+    thread.set("registerTime"sv, 0);
+    thread.set("unregisterTime"sv, milliseconds_since_start(end_time));
+    thread.set("samples"sv, gecko_table(Array { "stack"sv, "time"sv, "eventDelay"sv }, move(samples)));
+    thread.set("markers"sv, gecko_table(Array { "name"sv, "startTime"sv, "endTime"sv, "phase"sv, "category"sv, "data"sv }, {}));
+    thread.set("stackTable"sv, gecko_table(Array { "prefix"sv, "frame"sv }, move(stack_table)));
+    thread.set("frameTable"sv, gecko_table(Array { "location"sv, "relevantForJS"sv, "innerWindowID"sv, "implementation"sv, "line"sv, "column"sv, "category"sv, "subcategory"sv }, move(frame_table)));
+    thread.set("stringTable"sv, move(string_table));
+
+    JsonArray threads;
+    threads.must_append(move(thread));
+
+    JsonArray subcategories;
+    subcategories.must_append("Other"sv);
+
+    JsonObject category;
+    category.set("name"sv, "JavaScript"sv);
+    category.set("color"sv, "yellow"sv);
+    category.set("subcategories"sv, move(subcategories));
+
+    JsonArray categories;
+    categories.must_append(move(category));
+
+    JsonObject meta;
+    meta.set("version"sv, 24);
+    meta.set("product"sv, "Ladybird"sv);
+    meta.set("interval"sv, static_cast<double>(m_sampling_interval.to_microseconds()) / 1000.0);
+    meta.set("startTime"sv, static_cast<double>(m_start_wall_time.milliseconds_since_epoch()));
+    meta.set("shutdownTime"sv, JsonValue {});
+    meta.set("processType"sv, 0);
+    meta.set("stackwalk"sv, 0);
+    meta.set("debug"sv, false);
+    meta.set("presymbolicated"sv, true);
+    meta.set("categories"sv, move(categories));
+    meta.set("markerSchema"sv, JsonArray {});
+
+    JsonObject profile;
+    profile.set("meta"sv, move(meta));
+    profile.set("libs"sv, JsonArray {});
+    profile.set("pausedRanges"sv, JsonArray {});
+    profile.set("processes"sv, JsonArray {});
+    profile.set("threads"sv, move(threads));
+    return profile;
+}
+
+}
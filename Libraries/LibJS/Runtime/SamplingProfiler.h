@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/Noncopyable.h>
+#include <AK/RefPtr.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Utf16String.h>
+#include <AK/Vector.h>
+#include <LibGC/Root.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+#include <LibThreading/Forward.h>
+
+namespace JS {
+
+// Set by the sampling profiler's timer thread. The bytecode interpreter polls it on function entry and on
+// every taken jump, and native functions poll it before they return. A sample of the execution context
+// stack is recorded when it is set.
+JS_API extern Atomic<bool> g_sampling_profiler_sample_requested;
+
+// A sampling CPU profiler for JavaScript. Samples are only ever taken on the thread that runs the VM,
+// at the next safe point after the timer fires, so the profiler never inspects a stack that is being
+// mutated. A sample that is taken late is weighted by the number of timer ticks it covers, so that time
+// spent in long-running native code is not lost. Samples are aggregated into a call tree as they are
+// taken, and can be exported in the Chrome DevTools .cpuprofile format or the Gecko profile format used
+// by the Firefox Profiler.
+class JS_API SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static constexpr AK::Duration default_sampling_interval = AK::Duration::from_milliseconds(1);
+
+    explicit SamplingProfiler(VM&);
+    ~SamplingProfiler();
+
+    void start(AK::Duration sampling_interval = default_sampling_interval);
+    void stop();
+    [[nodiscard]] bool is_running() const { return m_running; }
+
+    void take_sample();
+
+    // The interpreter calls these when it enters and leaves its outermost run. Timer ticks that fire while no
+    // JavaScript is running are recorded under an "(idle)" node instead of being charged to the next sample.
+    void did_start_running_javascript();
+    void will_stop_running_javascript();
+
+    // https://chromedevtools.github.io/devtools-protocol/tot/Profiler/#type-Profile
+    [[nodiscard]] JsonObject to_cpuprofile() const;
+
+    // https://github.com/firefox-devtools/profiler/blob/main/docs-developer/gecko-profile-format.md
+    [[nodiscard]] JsonObject to_gecko_profile() const;
+
+private:
+    // A frame is created the first time a function is seen on the stack, and is shared by every node for
+    // that function. Only the start offset of the function is stored, its position is realized on export.
+    struct Frame {
+        Utf16String function_name;
+        RefPtr<SourceCode const> source_code;
+        u32 source_offset { 0 };
+    };
+
+    struct FramePosition {
+        String url;
+        i32 line { 0 };
+        i32 column { 0 };
+    };
+
+    struct Node {
+        size_t frame { 0 };
+        size_t parent { 0 };
+        u32 hit_count { 0 };
+        Vector<size_t> children;
+        HashMap<u32, u32> source_offset_ticks;
+    };
+
+    struct Sample {
+        size_t node { 0 };
+        u32 weight { 1 };
+        MonotonicTime time;
+    };
+
+    size_t frame_for(ExecutionContext const&);
+    size_t child_node(size_t parent, size_t frame);
+    Vector<Optional<FramePosition>> realize_frame_positions() const;
+    void record_idle_ticks();
+
+    VM& m_vm;
+
+    RefPtr<Threading::Thread> m_timer_thread;
+    Atomic<bool> m_should_stop { false };
+    Atomic<u32> m_pending_ticks { 0 };
+    Atomic<u32> m_pending_idle_ticks { 0 };
+    Atomic<bool> m_is_running_javascript { false };
+    bool m_running { false };
+    AK::Duration m_sampling_interval { default_sampling_interval };
+
+    Vector<Frame> m_frames;
+    HashMap<Bytecode::Executable const*, size_t> m_frame_for_executable;
+    HashMap<FunctionObject const*, size_t> m_frame_for_native_function;
+
+    // NB: The cells that frames are looked up by are kept alive while profiling, so their addresses can't be
+    //     reused by another function.
+    Vector<GC::Root<Bytecode::Executable>> m_executable_roots;
+    Vector<GC::Root<FunctionObject>> m_native_function_roots;
+
+    Vector<Node> m_nodes;
+    Vector<Sample> m_samples;
+
+    UnixDateTime m_start_wall_time { UnixDateTime::now_coarse() };
+    MonotonicTime m_start_time { MonotonicTime::now_coarse() };
+    MonotonicTime m_end_time { MonotonicTime::now_coarse() };
+};
+
+}
@@ -22,28 +22,19 @@ Set::Set(Object& prototype)
 {
 }
 
-void Set::initialize(Realm& realm)
-{
-    Base::initialize(realm);
-    m_values = Map::create(realm);
-}
-
 GC::Ref<Set> Set::copy() const
 {
     auto& vm = this->vm();
     auto& realm = *vm.current_realm();
-    // FIXME: This is very inefficient, but there's no better way to do this at the moment, as the underlying Map
-    //  implementation of m_values uses a non-copyable RedBlackTree.
     auto result = Set::create(realm);
-    for (auto const& entry : *this)
-        result->set_add(entry.key);
-    return *result;
+    result->m_table = m_table;
+    return result;
 }
 
 void Set::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    visitor.visit(m_values);
+    m_table.visit_edges(visitor);
 }
 
 // 24.2.1.2 GetSetRecord ( obj ), https://tc39.es/ecma262/#sec-getsetrecord
@@ -8,7 +8,7 @@
 
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
-#include <LibJS/Runtime/Map.h>
+#include <LibJS/Runtime/KeyedCollectionTable.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/Value.h>
 
@@ -21,24 +21,24 @@ class JS_API Set : public Object {
 public:
     static GC::Ref<Set> create(Realm&);
 
-    virtual void initialize(Realm&) override;
     virtual ~Set() override = default;
 
     virtual bool is_set_object() const final { return true; }
 
-    // NOTE: Unlike what the spec says, we implement Sets using an underlying map,
-    //       so all the functions below do not directly implement the operations as
+    // NOTE: Unlike what the spec says, we implement Sets using the same hash table as Maps (with every value
+    //       being undefined), so all the functions below do not directly implement the operations as
     //       defined by the specification.
 
-    void set_clear() { m_values->map_clear(); }
-    bool set_remove(Value const& value) { return m_values->map_remove(value); }
-    bool set_has(Value const& key) const { return m_values->map_has(key); }
-    void set_add(Value const& key) { m_values->map_set(key, js_undefined()); }
-    size_t set_size() const { return m_values->map_size(); }
+    void set_clear() { m_table.clear(); }
+    bool set_remove(Value const& value) { return m_table.remove(value); }
+    bool set_has(Value const& key) const { return m_table.contains(key); }
+    void set_add(Value const& key) { m_table.set(key, js_undefined()); }
+    size_t set_size() const { return m_table.size(); }
 
-    auto begin() const { return const_cast<Map const&>(*m_values).begin(); }
-    auto begin() { return m_values->begin(); }
-    auto end() const { return m_values->end(); }
+    using ConstIterator = KeyedCollectionTable::Iterator;
+
+    ConstIterator begin() const { return m_table.begin(*this); }
+    KeyedCollectionTable::EndIterator end() const { return m_table.end(); }
 
     GC::Ref<Set> copy() const;
 
@@ -47,7 +47,7 @@ private:
 
     virtual void visit_edges(Visitor& visitor) override;
 
-    GC::Ptr<Map> m_values;
+    KeyedCollectionTable m_table;
 };
 
 // 24.2.1.1 Set Records, https://tc39.es/ecma262/#sec-set-records
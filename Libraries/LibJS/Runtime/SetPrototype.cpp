@@ -213,14 +213,14 @@ JS_DEFINE_NATIVE_FUNCTION(SetPrototype::for_each)
         // a. Let e be entries[index].
         // b. Set index to index + 1.
         // c. If e is not empty, then
-        // NOTE: This is handled in Map::IteratorImpl.
+        // NOTE: This is handled in KeyedCollectionTable::Iterator.
 
         // i. Perform ? Call(callbackfn, thisArg, « e, e, S »).
         TRY(call(vm, callback_fn.as_function(), this_arg, entry.key, entry.key, set));
 
         // ii. NOTE: The number of elements in entries may have increased during execution of callbackfn.
         // iii. Set numEntries to the number of elements in entries.
-        // NOTE: This is handled in Map::IteratorImpl.
+        // NOTE: This is handled in KeyedCollectionTable::Iterator.
     }
 
     // 8. Return undefined.
@@ -21,7 +21,7 @@ static FunctionLocal to_function_local(Identifier const& identifier)
 GC_DEFINE_ALLOCATOR(SharedFunctionInstanceData);
 
 SharedFunctionInstanceData::SharedFunctionInstanceData(
-    VM& vm,
+    VM&,
     FunctionKind kind,
     Utf16FlyString name,
     i32 function_length,
@@ -44,6 +44,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
     , m_contains_direct_call_to_eval(parsing_insights.contains_direct_call_to_eval)
     , m_is_arrow_function(is_arrow_function)
     , m_uses_this(parsing_insights.uses_this)
+    , m_uses_this_from_environment(parsing_insights.uses_this_from_environment)
 {
     if (m_is_arrow_function)
         m_this_mode = ThisMode::Lexical;
@@ -72,6 +73,19 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
         for (auto const& parameter : m_formal_parameters->parameters())
             m_parameter_names_for_mapped_arguments.append(parameter.binding.get<NonnullRefPtr<Identifier const>>()->string());
     }
+}
+
+// OPTIMIZATION: Most functions in large scripts are never called, and the data below is only needed to compile the
+//               function. Computing it eagerly would also recursively create SharedFunctionInstanceData for every
+//               nested function declaration, so we defer it until the function is about to be compiled.
+void SharedFunctionInstanceData::ensure_function_declaration_instantiation_data(VM& vm)
+{
+    if (m_has_function_declaration_instantiation_data)
+        return;
+    m_has_function_declaration_instantiation_data = true;
+
+    VERIFY(m_formal_parameters);
+    VERIFY(m_ecmascript_code);
 
     // NOTE: The following steps are from FunctionDeclarationInstantiation that could be executed once
     //       and then reused in all subsequent function instantiations.
@@ -165,7 +179,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
     size_t* environment_size = nullptr;
     size_t parameter_environment_bindings_count = 0;
     // 19. If strict is true or hasParameterExpressions is false, then
-    if (strict || !m_has_parameter_expressions) {
+    if (m_strict || !m_has_parameter_expressions) {
         // a. NOTE: Only a single Environment Record is needed for the parameters, since calls to eval in strict mode code cannot create new bindings which are visible outside of the eval.
         // b. Let env be the LexicalEnvironment of calleeContext
         // NOTE: Here we are only interested in the size of the environment.
@@ -293,7 +307,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
         }));
     }
 
-    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || parsing_insights.uses_this_from_environment || m_contains_direct_call_to_eval;
+    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || m_uses_this_from_environment || m_contains_direct_call_to_eval;
 }
 
 void SharedFunctionInstanceData::visit_edges(Visitor& visitor)
@@ -123,6 +123,8 @@ public:
     bool m_arguments_object_needed { false };
     bool m_function_environment_needed { false };
     bool m_uses_this { false };
+    bool m_uses_this_from_environment { false };
+    bool m_has_function_declaration_instantiation_data { false };
     Vector<VarBinding> m_var_names_to_initialize_binding;
     Vector<Utf16FlyString> m_function_names_to_initialize_binding;
 
@@ -142,6 +144,10 @@ public:
     ConstructorKind m_constructor_kind : 1 { ConstructorKind::Base };        // [[ConstructorKind]]
     bool m_is_class_constructor : 1 { false };                               // [[IsClassConstructor]]
 
+    // Computes the FunctionDeclarationInstantiation data (m_has_parameter_expressions onwards), which is only needed
+    // once the function is compiled. Must be called before the function is compiled for the first time.
+    void ensure_function_declaration_instantiation_data(VM&);
+
     void clear_compile_inputs();
 
 private:
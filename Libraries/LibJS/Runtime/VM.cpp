@@ -28,6 +28,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/Temporal/Instant.h>
 #include <LibJS/Runtime/VM.h>
@@ -532,6 +533,20 @@ void VM::dump_backtrace() const
     }
 }
 
+SamplingProfiler& VM::sampling_profiler()
+{
+    if (!m_sampling_profiler)
+        m_sampling_profiler = make<SamplingProfiler>(*this);
+    return *m_sampling_profiler;
+}
+
+SamplingProfiler* VM::running_sampling_profiler()
+{
+    if (!m_sampling_profiler || !m_sampling_profiler->is_running())
+        return nullptr;
+    return m_sampling_profiler.ptr();
+}
+
 void VM::save_execution_context_stack()
 {
     m_saved_execution_context_stacks.append(move(m_execution_context_stack));
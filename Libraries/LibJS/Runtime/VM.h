@@ -264,6 +264,10 @@ public:
     Agent* agent() { return m_agent; }
     Agent const* agent() const { return m_agent; }
 
+    // The sampling profiler is created lazily, the first time it is requested.
+    SamplingProfiler& sampling_profiler();
+    SamplingProfiler* running_sampling_profiler();
+
     void save_execution_context_stack();
     void clear_execution_context_stack();
     void restore_execution_context_stack();
@@ -365,6 +369,8 @@ private:
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
 
+    OwnPtr<SamplingProfiler> m_sampling_profiler;
+
     bool m_dynamic_imports_allowed { false };
 };
 
@@ -14,6 +14,8 @@
 
 namespace Media::FFmpeg {
 
+static constexpr unsigned MAXIMUM_DECODER_THREAD_COUNT = 16;
+
 static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat const* formats)
 {
     while (*formats >= 0) {
@@ -63,7 +65,11 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
 
     codec_context->get_format = negotiate_output_format;
     codec_context->time_base = { 1, 1'000'000 };
-    codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
+    // Decode several frames at once with frame threading where the codec supports it, and additionally split each
+    // frame into slices for codecs that can only decode one frame at a time. High resolution video needs more than a
+    // handful of threads to decode in real time without a hardware decoder.
+    codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), MAXIMUM_DECODER_THREAD_COUNT));
+    codec_context->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
 
     if (!codec_initialization_data.is_empty()) {
         if (codec_initialization_data.size() > NumericLimits<int>::max())
@@ -14,6 +14,17 @@ static constexpr u64 PRECEDING_DATA_SIZE = 1 * KiB;
 static constexpr u64 FORWARD_REQUEST_THRESHOLD = 1 * MiB;
 static constexpr AK::Duration CURSOR_ACTIVE_TIME = AK::Duration::from_milliseconds(50);
 
+// Once more than this much data is buffered, data that is not near any cursor is evicted.
+static constexpr u64 MAXIMUM_BUFFERED_SIZE = 128 * MiB;
+static constexpr u64 RETAINED_SIZE_BEHIND_CURSORS = 8 * MiB;
+static constexpr u64 RETAINED_SIZE_AHEAD_OF_CURSORS = 64 * MiB;
+// Chunks are only cut down once they extend this far past the retained range, so that we don't copy the remaining
+// data every time a cursor advances.
+static constexpr u64 EVICTION_GRANULARITY = 16 * MiB;
+// A request that was paused because it ran past the retained range is resumed once a cursor gets this close to the end
+// of the data that is buffered ahead of it.
+static constexpr u64 RESUME_REQUEST_THRESHOLD = RETAINED_SIZE_AHEAD_OF_CURSORS / 2;
+
 NonnullRefPtr<IncrementallyPopulatedStream> IncrementallyPopulatedStream::create_empty()
 {
     return adopt_ref(*new IncrementallyPopulatedStream());
@@ -51,6 +62,19 @@ void IncrementallyPopulatedStream::set_data_request_callback(DataRequestCallback
     m_data_request_callback = move(callback);
 }
 
+void IncrementallyPopulatedStream::set_pause_request_callback(PauseRequestCallback callback)
+{
+    Threading::MutexLocker locker { m_mutex };
+    m_pause_request_callback = move(callback);
+}
+
+void IncrementallyPopulatedStream::set_data_eviction_enabled(bool enabled)
+{
+    Threading::MutexLocker locker { m_mutex };
+    m_data_eviction_enabled = enabled;
+    evict_distant_data_while_locked();
+}
+
 void IncrementallyPopulatedStream::add_chunk_at(u64 offset, ReadonlyBytes data)
 {
     VERIFY(!data.is_null());
@@ -60,12 +84,16 @@ void IncrementallyPopulatedStream::add_chunk_at(u64 offset, ReadonlyBytes data)
 
     Threading::MutexLocker locker { m_mutex };
 
+    m_highest_chunk_end = max(m_highest_chunk_end, new_chunk_end);
+
     auto previous_chunk_iter = m_chunks.find_largest_not_above_iterator(offset);
 
     // Add a new chunk to the collection if there are none.
     if (previous_chunk_iter.is_end() || previous_chunk_iter->end() < offset) {
         DataChunk new_chunk { offset, MUST(ByteBuffer::copy(data)) };
         m_chunks.insert(offset, move(new_chunk));
+        m_buffered_size += data.size();
+        evict_distant_data_while_locked();
         m_state_changed.broadcast();
         return;
     }
@@ -80,6 +108,7 @@ void IncrementallyPopulatedStream::add_chunk_at(u64 offset, ReadonlyBytes data)
     }
 
     // Expand the existing chunk to contain this new data.
+    m_buffered_size += new_chunk_end - chunk.end();
     buffer.resize(new_chunk_end - chunk.offset());
     data.copy_to(buffer.bytes().slice(offset - chunk.offset()));
 
@@ -90,6 +119,7 @@ void IncrementallyPopulatedStream::add_chunk_at(u64 offset, ReadonlyBytes data)
     if (!next_chunk_iter.is_end() && next_chunk_iter->offset() <= previous_chunk_iter->end()) {
         auto& next_chunk = *next_chunk_iter;
 
+        m_buffered_size -= chunk.end() - next_chunk.offset();
         buffer.resize(next_chunk.end() - chunk.offset());
         next_chunk.data().bytes().copy_to(buffer.bytes().slice(next_chunk.offset() - chunk.offset()));
 
@@ -98,13 +128,90 @@ void IncrementallyPopulatedStream::add_chunk_at(u64 offset, ReadonlyBytes data)
         begin_new_request_while_locked(chunk.end());
     }
 
+    evict_distant_data_while_locked();
     m_state_changed.broadcast();
 }
 
+void IncrementallyPopulatedStream::evict_distant_data_while_locked()
+{
+    if (!m_data_eviction_enabled || !m_data_request_callback || m_buffered_size <= MAXIMUM_BUFFERED_SIZE)
+        return;
+
+    // Retain the data around the cursors that are currently reading. If none of them are, keep the data around all
+    // cursors, since we don't know which of them will be read from next.
+    auto now = MonotonicTime::now_coarse();
+    Optional<u64> lowest_position;
+    Optional<u64> highest_position;
+    auto include_cursor_position = [&](Cursor const& cursor) {
+        lowest_position = min(lowest_position.value_or(cursor.m_position), cursor.m_position);
+        highest_position = max(highest_position.value_or(cursor.m_position), cursor.m_position);
+    };
+    for (auto const& cursor : m_cursors) {
+        if (now < cursor.m_active_timeout || cursor.m_blocked)
+            include_cursor_position(cursor);
+    }
+    if (!lowest_position.has_value()) {
+        for (auto const& cursor : m_cursors)
+            include_cursor_position(cursor);
+    }
+    if (!lowest_position.has_value())
+        return;
+
+    auto retained_start = lowest_position.value() > RETAINED_SIZE_BEHIND_CURSORS ? lowest_position.value() - RETAINED_SIZE_BEHIND_CURSORS : 0;
+    auto retained_end = highest_position.value() + RETAINED_SIZE_AHEAD_OF_CURSORS;
+
+    // Everything the current request delivers from here on would be evicted right away, so stop it until the cursors
+    // catch up with it.
+    if (!m_request_paused && m_pause_request_callback && m_last_chunk_end >= retained_end) {
+        if (auto event_loop = m_callback_event_loop->take()) {
+            m_request_paused = true;
+            event_loop->deferred_invoke([stream = NonnullRefPtr(*this)] {
+                if (stream->m_pause_request_callback)
+                    stream->m_pause_request_callback();
+            });
+        }
+    }
+
+    Vector<u64> chunks_to_remove;
+    Vector<DataChunk> chunks_to_insert;
+    for (auto const& chunk : m_chunks) {
+        if (chunk.end() <= retained_start || chunk.offset() >= retained_end) {
+            chunks_to_remove.append(chunk.offset());
+            continue;
+        }
+
+        auto evicts_start = chunk.offset() + EVICTION_GRANULARITY < retained_start;
+        auto evicts_end = chunk.end() > retained_end + EVICTION_GRANULARITY;
+        if (!evicts_start && !evicts_end)
+            continue;
+
+        // A ByteBuffer does not release its memory when it is shrunk, so copy the retained data into a new chunk.
+        auto new_start = evicts_start ? retained_start : chunk.offset();
+        auto new_end = evicts_end ? retained_end : chunk.end();
+        auto new_data = MUST(ByteBuffer::copy(chunk.data().bytes().slice(new_start - chunk.offset(), new_end - new_start)));
+        chunks_to_remove.append(chunk.offset());
+        chunks_to_insert.empend(new_start, move(new_data));
+    }
+
+    for (auto offset : chunks_to_remove) {
+        auto* chunk = m_chunks.find(offset);
+        VERIFY(chunk);
+        m_buffered_size -= chunk->size();
+        VERIFY(m_chunks.remove(offset));
+    }
+    for (auto& chunk : chunks_to_insert) {
+        m_buffered_size += chunk.size();
+        auto offset = chunk.offset();
+        m_chunks.insert(offset, move(chunk));
+    }
+}
+
 void IncrementallyPopulatedStream::close()
 {
     Threading::MutexLocker locker { m_mutex };
-    m_expected_size = m_last_chunk_end;
+    // NB: A request may have started in the middle of the stream or have been stopped early, so the end of the last
+    //     chunk is not necessarily the end of the stream. Never shrink a size that we already know.
+    m_expected_size = max(m_expected_size.value_or(0), m_highest_chunk_end);
     m_closed = true;
     m_state_changed.broadcast();
 }
@@ -132,10 +239,11 @@ Optional<u64> IncrementallyPopulatedStream::expected_size() const
 
 void IncrementallyPopulatedStream::begin_new_request_while_locked(u64 position)
 {
-    if (position == m_currently_requested_position)
+    if (position == m_currently_requested_position && !m_request_paused)
         return;
 
     m_currently_requested_position = position;
+    m_request_paused = false;
     m_last_chunk_end = position;
 
     if (m_expected_size.has_value() && position >= m_expected_size.value())
@@ -160,8 +268,14 @@ static u64 adjust_request_position(u64 position)
 bool IncrementallyPopulatedStream::check_if_data_is_available_or_begin_request_while_locked(MonotonicTime now, u64 position, u64 length)
 {
     auto* chunk = m_chunks.find_largest_not_above(position);
-    if (!chunk)
-        return m_closed;
+    if (!chunk) {
+        if (m_closed && position >= m_expected_size.value())
+            return true;
+        // If the current request has already passed this position, the data was evicted and must be requested again.
+        if (position < m_currently_requested_position || (m_data_eviction_enabled && position < m_last_chunk_end) || m_request_paused)
+            begin_new_request_while_locked(position);
+        return false;
+    }
 
     VERIFY(position >= chunk->offset());
 
@@ -180,8 +294,14 @@ bool IncrementallyPopulatedStream::check_if_data_is_available_or_begin_request_w
             potential_request_position = other_cursor.m_position;
         }
     }
-    if (m_currently_requested_position > potential_request_position || potential_request_position > m_last_chunk_end + FORWARD_REQUEST_THRESHOLD)
+    if (m_request_paused) {
+        if (potential_request_position < position + RESUME_REQUEST_THRESHOLD)
+            begin_new_request_while_locked(potential_request_position);
+    } else if (m_currently_requested_position > potential_request_position || (m_data_eviction_enabled && potential_request_position < m_last_chunk_end) || potential_request_position > m_last_chunk_end + FORWARD_REQUEST_THRESHOLD) {
+        // Data between the start of the current request and the end of the last chunk we received can only be missing
+        // if it was evicted, in which case it will not arrive unless we request it again.
         begin_new_request_while_locked(potential_request_position);
+    }
 
     u64 end = position + length;
     if (m_closed && end > m_expected_size.value())
@@ -38,8 +38,19 @@ public:
     using DataRequestCallback = Function<void(u64 offset)>;
     void set_data_request_callback(DataRequestCallback);
 
+    // Callback invoked when the current request is delivering data so far ahead of all cursors that it would be evicted
+    // right away. The request should be stopped, and it is resumed through the data request callback once the cursors
+    // approach the end of the buffered data. The callback is invoked on the event loop of the data request callback.
+    using PauseRequestCallback = Function<void()>;
+    void set_pause_request_callback(PauseRequestCallback);
+
     void add_chunk_at(u64 offset, ReadonlyBytes);
 
+    // When enabled, data far away from all cursors is dropped once the buffered size exceeds a limit. Evicted data is
+    // requested again through the data request callback if a cursor needs it later, so this should only be enabled if
+    // the callback is able to fetch data at arbitrary offsets.
+    void set_data_eviction_enabled(bool);
+
     void close();
 
     u64 size();
@@ -106,19 +117,25 @@ private:
     void begin_new_request_while_locked(u64 position);
     bool check_if_data_is_available_or_begin_request_while_locked(MonotonicTime now, u64 position, u64 length);
     size_t read_from_chunks_while_locked(u64 position, Bytes& bytes) const;
+    void evict_distant_data_while_locked();
 
     mutable Threading::Mutex m_mutex;
     Vector<Cursor&> m_cursors;
     Threading::ConditionVariable m_state_changed { m_mutex };
 
     Chunks m_chunks;
+    u64 m_buffered_size { 0 };
+    bool m_data_eviction_enabled { false };
     Optional<u64> m_expected_size;
     bool m_closed { false };
 
     RefPtr<Core::WeakEventLoopReference> m_callback_event_loop;
     DataRequestCallback m_data_request_callback;
+    PauseRequestCallback m_pause_request_callback;
     u64 m_currently_requested_position { 0 };
     u64 m_last_chunk_end { 0 };
+    u64 m_highest_chunk_end { 0 };
+    bool m_request_paused { false };
 };
 
 }
@@ -84,8 +84,10 @@ void VideoDataProvider::set_frames_queue_is_full_handler(FramesQueueIsFullHandle
 TimedImage VideoDataProvider::retrieve_frame()
 {
     auto locker = m_thread_data->take_lock();
-    if (m_thread_data->queue().is_empty())
+    if (m_thread_data->queue().is_empty()) {
+        m_thread_data->handle_queue_underrun_while_locked();
         return TimedImage();
+    }
     auto result = m_thread_data->take_frame();
     m_thread_data->wake();
     return result;
@@ -173,13 +175,38 @@ VideoDataProvider::ImageQueue& VideoDataProvider::ThreadData::queue()
 
 TimedImage VideoDataProvider::ThreadData::take_frame()
 {
+    m_has_delivered_frame_since_seek = true;
     return m_queue.dequeue();
 }
 
+void VideoDataProvider::ThreadData::handle_queue_underrun_while_locked()
+{
+    if (m_requested_state != RequestedState::Running || m_is_in_error_state || is_blocked())
+        return;
+    if (m_queue_max_size >= MAXIMUM_QUEUE_SIZE)
+        return;
+
+    // NB: Only an empty queue during steady playback means that decoding is too slow. The queue is also empty before
+    //     the first frame after starting or seeking has been decoded, and once all frames have been presented at the end
+    //     of the stream.
+    if (!m_has_delivered_frame_since_seek || m_reached_end_of_stream || m_last_processed_seek_id != m_seek_id)
+        return;
+
+    // Decoding fell behind playback, so allow more frames to be decoded ahead of time to absorb the variation in
+    // decoding time between frames.
+    m_queue_max_size = min(m_queue_max_size + 2, MAXIMUM_QUEUE_SIZE);
+    dbgln_if(PLAYBACK_MANAGER_DEBUG, "Video Data Provider: Frame queue ran dry, increasing its size to {}", m_queue_max_size);
+    wake();
+}
+
 void VideoDataProvider::ThreadData::seek(AK::Duration timestamp, SeekMode seek_mode, SeekCompletionHandler&& completion_handler)
 {
     auto locker = take_lock();
     m_seek_id++;
+    // Underruns while playback restarts after a seek are expected, so let the queue shrink back towards its initial size
+    // and only grow again if decoding falls behind once frames are flowing.
+    m_queue_max_size = max(INITIAL_QUEUE_SIZE, m_queue_max_size / 2);
+    m_has_delivered_frame_since_seek = false;
     m_seek_completion_handler = move(completion_handler);
     m_seek_timestamp = timestamp;
     m_seek_mode = seek_mode;
@@ -329,6 +356,7 @@ bool VideoDataProvider::ThreadData::handle_seek()
             seek_id = m_seek_id;
             timestamp = m_seek_timestamp;
             mode = m_seek_mode;
+            m_reached_end_of_stream = false;
             m_demuxer->reset_blocking_reads_aborted_for_track(m_track);
         }
 
@@ -390,6 +418,10 @@ bool VideoDataProvider::ThreadData::handle_seek()
                         continue;
                     }
 
+                    {
+                        auto locker = take_lock();
+                        m_reached_end_of_stream = true;
+                    }
                     m_decoder->signal_end_of_stream();
                 } else {
                     handle_error(coded_frame_result.release_error());
@@ -487,6 +519,10 @@ void VideoDataProvider::ThreadData::push_data_and_decode_some_frames()
     auto sample_result = m_demuxer->get_next_sample_for_track(m_track);
     if (sample_result.is_error()) {
         if (sample_result.error().category() == DecoderErrorCategory::EndOfStream) {
+            {
+                auto locker = take_lock();
+                m_reached_end_of_stream = true;
+            }
             m_decoder->signal_end_of_stream();
         } else {
             set_error_and_wait_for_seek(sample_result.release_error());
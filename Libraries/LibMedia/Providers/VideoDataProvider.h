@@ -31,6 +31,10 @@ class MEDIA_API VideoDataProvider final : public AtomicRefCounted<VideoDataProvi
 
 public:
     static constexpr size_t QUEUE_CAPACITY = 8;
+    // The number of decoded frames to keep ready grows from the initial size whenever the display runs out of frames
+    // while the demuxer is not waiting for data, i.e. when decoding is not keeping up.
+    static constexpr size_t INITIAL_QUEUE_SIZE = 4;
+    static constexpr size_t MAXIMUM_QUEUE_SIZE = 12;
     using ImageQueue = Queue<TimedImage, QUEUE_CAPACITY>;
 
     using ErrorHandler = Function<void(DecoderError&&)>;
@@ -75,6 +79,7 @@ private:
 
         ImageQueue& queue();
         TimedImage take_frame();
+        void handle_queue_underrun_while_locked();
 
         void seek(AK::Duration timestamp, SeekMode, SeekCompletionHandler&&);
 
@@ -119,7 +124,9 @@ private:
 
         RefPtr<MediaTimeProvider> m_time_provider;
 
-        size_t m_queue_max_size { 4 };
+        size_t m_queue_max_size { INITIAL_QUEUE_SIZE };
+        bool m_has_delivered_frame_since_seek { false };
+        bool m_reached_end_of_stream { false };
         ImageQueue m_queue;
         FrameEndTimeHandler m_frame_end_time_handler;
         ErrorHandler m_error_handler;
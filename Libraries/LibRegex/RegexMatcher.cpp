@@ -185,6 +185,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     input.regex_options = m_regex_options | regex_options.value_or({}).value();
     input.start_offset = m_pattern->start_offset;
     MatchState state(m_pattern->parser_result.capture_groups_count, input.regex_options);
+    PikeVMBuffers pike_vm_buffers;
     size_t lines_to_skip = 0;
 
     bool unicode = input.regex_options.has_flag_set(AllFlags::Unicode) || input.regex_options.has_flag_set(AllFlags::UnicodeSets);
@@ -280,7 +281,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.modifier_stack.clear();
             state.current_options = input.regex_options;
 
-            auto result = execute(input, state, temp_operations);
+            auto result = execute(input, state, temp_operations, pike_vm_buffers);
             // This success is acceptable only if it doesn't read anything from the input (input length is 0).
             if (result == ExecuteResult::Matched && (state.string_position <= view_index)) {
                 operations = temp_operations;
@@ -344,7 +345,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.string_position_before_rseek = NumericLimits<size_t>::max();
             state.string_position_in_code_units_before_rseek = NumericLimits<size_t>::max();
 
-            if (auto const result = execute(input, state, operations); result == ExecuteResult::Matched) {
+            if (auto const result = execute(input, state, operations, pike_vm_buffers); result == ExecuteResult::Matched) {
                 succeeded = true;
 
                 if (input.regex_options.has_flag_set(AllFlags::MatchNotEndOfLine) && state.string_position == input.view.length()) {
@@ -522,7 +523,7 @@ struct SufficientlyUniformValueTraits : DefaultTraits<u64> {
 };
 
 template<class Parser>
-Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations) const
+Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations, PikeVMBuffers& pike_vm_buffers) const
 {
     if (m_pattern->parser_result.optimization_data.pure_substring_search.has_value() && input.view.is_u16_view()) {
         // Yay, we can do a simple substring search!
@@ -565,6 +566,9 @@ Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input,
         }
     }
 
+    if (m_pattern->parser_result.optimization_data.can_use_pike_vm)
+        return execute_pike_vm(input, state, operations, pike_vm_buffers);
+
     BumpAllocatedLinkedList<MatchState> states_to_try_next;
     HashTable<u64, SufficientlyUniformValueTraits> seen_state_hashes;
 #if REGEX_DEBUG
@@ -706,6 +710,121 @@ Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input,
     VERIFY_NOT_REACHED();
 }
 
+// A Pike VM: instead of trying one alternative at a time and backtracking on failure, all alternatives ("threads")
+// advance through the input together, ordered by priority. Of all threads that reach the same instruction at the same
+// string position, only the highest priority one is kept, since the others could not produce a better match. This
+// bounds the work per string position by the size of the bytecode, so matching takes linear time.
+// Regex::determine_if_pike_vm_can_be_used() makes sure this gives the same results as backtracking.
+template<class Parser>
+Matcher<Parser>::ExecuteResult Matcher<Parser>::execute_pike_vm(MatchInput const& input, MatchState& state, size_t& operations, PikeVMBuffers& buffers) const
+{
+    auto& bytecode = m_pattern->parser_result.bytecode.template get<FlatByteCode>();
+
+    // The threads, in priority order. A thread's string_position is where it resumes, which may be further ahead than
+    // the current position if its last compare consumed more than one character.
+    auto& threads = buffers.threads;
+    auto& next_threads = buffers.next_threads;
+    auto& pending = buffers.pending;
+    threads.clear_with_capacity();
+    threads.append(state);
+
+    auto& visited_in_generation = buffers.visited_in_generation;
+    if (visited_in_generation.size() != bytecode.size() + 1) {
+        visited_in_generation.clear_with_capacity();
+        visited_in_generation.resize(bytecode.size() + 1);
+    }
+    auto& generation = buffers.generation;
+
+    Optional<MatchState> best_match;
+    // Like in the backtracking matcher, the way the last thread failed decides whether later start positions in this
+    // view are worth trying.
+    bool no_further_possible_matches = false;
+
+    while (!threads.is_empty()) {
+        auto position = threads.first().string_position;
+        for (auto const& thread : threads)
+            position = min(position, thread.string_position);
+        ++generation;
+
+        next_threads.clear_with_capacity();
+        bool cut_lower_priority_threads = false;
+
+        for (auto& thread : threads) {
+            if (cut_lower_priority_threads)
+                break;
+            if (thread.string_position != position) {
+                next_threads.append(move(thread));
+                continue;
+            }
+
+            // Follow this thread until every branch of it either died, consumed input or matched. Branches are
+            // explored depth-first with the higher priority branch first, to keep the resulting threads in order.
+            pending.clear_with_capacity();
+            pending.append(move(thread));
+            while (!pending.is_empty() && !cut_lower_priority_threads) {
+                auto current = pending.take_last();
+                for (;;) {
+                    if (current.instruction_position < visited_in_generation.size()) {
+                        if (visited_in_generation[current.instruction_position] == generation)
+                            break;
+                        visited_in_generation[current.instruction_position] = generation;
+                    }
+
+                    auto& opcode = bytecode.get_opcode(current);
+                    auto const opcode_id = opcode.opcode_id();
+                    auto const opcode_size = opcode.size();
+                    ++operations;
+
+#if REGEX_DEBUG
+                    s_regex_dbg.print_opcode("PikeVM", opcode, current, 0, false);
+#endif
+
+                    auto result = opcode.execute(input, current);
+                    current.instruction_position += opcode_size;
+                    input.fork_to_replace.clear();
+
+                    if (result == ExecutionResult::Continue) {
+                        if ((opcode_id == OpCodeId::Compare || opcode_id == OpCodeId::CompareSimple) && current.string_position != position) {
+                            next_threads.append(move(current));
+                            break;
+                        }
+                        continue;
+                    }
+
+                    if (result == ExecutionResult::Fork_PrioHigh) {
+                        pending.append(current);
+                        current.instruction_position = current.fork_at_position;
+                        continue;
+                    }
+
+                    if (result == ExecutionResult::Fork_PrioLow) {
+                        pending.append(current);
+                        pending.last().instruction_position = current.fork_at_position;
+                        continue;
+                    }
+
+                    if (result == ExecutionResult::Succeeded) {
+                        // Everything after this thread has lower priority, so it can't produce a better match.
+                        best_match = move(current);
+                        cut_lower_priority_threads = true;
+                        break;
+                    }
+                    no_further_possible_matches = result == ExecutionResult::Failed_ExecuteLowPrioForksButNoFurtherPossibleMatches;
+                    break;
+                }
+            }
+        }
+
+        swap(threads, next_threads);
+    }
+
+    if (!best_match.has_value())
+        return no_further_possible_matches ? ExecuteResult::DidNotMatchAndNoFurtherPossibleMatchesInView : ExecuteResult::DidNotMatch;
+
+    state = best_match.release_value();
+    return ExecuteResult::Matched;
+}
+
 template class Matcher<PosixBasicParser>;
 template class Regex<PosixBasicParser>;
 
@@ -76,7 +76,20 @@ private:
         Matched,
         DidNotMatchAndNoFurtherPossibleMatchesInView,
     };
-    ExecuteResult execute(MatchInput const& input, MatchState& state, size_t& operations) const;
+
+    // The Pike VM's thread lists, kept for all start positions of a single match() call.
+    struct PikeVMBuffers {
+        Vector<MatchState> threads;
+        Vector<MatchState> next_threads;
+        Vector<MatchState> pending;
+        // The generation in which each instruction was last reached, one generation per string position. Generations
+        // keep counting up across start positions, so this never needs to be cleared.
+        Vector<size_t> visited_in_generation;
+        size_t generation { 0 };
+    };
+
+    ExecuteResult execute(MatchInput const& input, MatchState& state, size_t& operations, PikeVMBuffers&) const;
+    ExecuteResult execute_pike_vm(MatchInput const& input, MatchState& state, size_t& operations, PikeVMBuffers&) const;
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
@@ -241,6 +254,7 @@ private:
     void attempt_rewrite_dot_star_sequences_as_seek(BasicBlockList const&);
     void rewrite_simple_compares(BasicBlockList const&);
     void fill_optimization_data(BasicBlockList const&);
+    void determine_if_pike_vm_can_be_used();
 };
 
 // free standing functions for match, search and has_match
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/Debug.h>
 #include <AK/Enumerate.h>
 #include <AK/Function.h>
@@ -388,6 +389,8 @@ void Regex<Parser>::run_optimization_passes()
     rewrite_simple_compares(blocks);
 
     fill_optimization_data(split_basic_blocks(parser_result.bytecode.template get<ByteCode>()));
+
+    determine_if_pike_vm_can_be_used();
 }
 
 struct StaticallyInterpretedCompares {
@@ -631,6 +634,169 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
     }
 }
 
+template<typename Parser>
+void Regex<Parser>::determine_if_pike_vm_can_be_used()
+{
+    // The Pike VM (see Matcher::execute_pike_vm()) runs all alternatives in lockstep, and only keeps the highest
+    // priority thread for each instruction at each string position. That is only equivalent to backtracking if nothing
+    // but the instruction and string positions can affect whether a thread ends up matching, which rules out
+    // backreferences, lookarounds, counted repetitions and modifier groups.
+    // Keeping all threads around costs more than backtracking does on ordinary patterns, so the Pike VM is only used
+    // for patterns that can backtrack catastrophically: those with a loop whose body can itself fork, i.e. a nested
+    // quantifier or an alternation inside a repetition, like (a+)+ or (a|a)*.
+    auto& bytecode = parser_result.bytecode.template get<ByteCode>();
+    auto bytecode_size = bytecode.size();
+    if (bytecode_size == 0)
+        return;
+
+    auto state = MatchState::only_for_enumeration();
+
+    auto for_each_empty_successor = [&](size_t instruction_position, auto callback) {
+        state.instruction_position = instruction_position;
+        auto& opcode = bytecode.get_opcode(state);
+        auto next = instruction_position + opcode.size();
+        auto jump_target = [&]<template<typename> class T>() {
+            auto& op = static_cast<T<ByteCode> const&>(opcode);
+            return static_cast<size_t>(static_cast<ssize_t>(next) + op.offset());
+        };
+
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Jump:
+            callback(jump_target.template operator()<OpCode_Jump>());
+            break;
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump:
+            callback(next);
+            callback(jump_target.template operator()<OpCode_ForkJump>());
+            break;
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay:
+            callback(next);
+            callback(jump_target.template operator()<OpCode_ForkStay>());
+            break;
+        case OpCodeId::JumpNonEmpty:
+            callback(next);
+            callback(jump_target.template operator()<OpCode_JumpNonEmpty>());
+            break;
+        case OpCodeId::ForkIf:
+            callback(next);
+            callback(jump_target.template operator()<OpCode_ForkIf>());
+            break;
+        case OpCodeId::Compare:
+        case OpCodeId::CompareSimple:
+        case OpCodeId::Exit:
+            break;
+        default:
+            callback(next);
+            break;
+        }
+    };
+
+    auto backward_jump_target = [&](size_t instruction_position) -> Optional<size_t> {
+        Optional<size_t> target;
+        for_each_empty_successor(instruction_position, [&](size_t successor) {
+            if (successor <= instruction_position)
+                target = successor;
+        });
+        return target;
+    };
+
+    struct Loop {
+        size_t start;
+        size_t end;
+    };
+    Vector<size_t> checkpoints;
+    Vector<size_t> forks;
+    Vector<Loop> loops;
+    for (state.instruction_position = 0; state.instruction_position < bytecode_size;) {
+        auto instruction_position = state.instruction_position;
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceJump:
+        case OpCodeId::ForkReplaceStay:
+        case OpCodeId::ForkIf:
+        case OpCodeId::JumpNonEmpty:
+            forks.append(instruction_position);
+            [[fallthrough]];
+        case OpCodeId::Jump:
+            if (auto target = backward_jump_target(instruction_position); target.has_value())
+                loops.append({ *target, instruction_position });
+            state.instruction_position = instruction_position;
+            break;
+        case OpCodeId::Compare:
+        case OpCodeId::CompareSimple: {
+            auto flat_compares = opcode.opcode_id() == OpCodeId::Compare
+                ? to<OpCode_Compare>(opcode).flat_compares()
+                : to<OpCode_CompareSimple>(opcode).flat_compares();
+            for (auto const& compare : flat_compares) {
+                if (compare.type == CharacterCompareType::Reference || compare.type == CharacterCompareType::NamedReference)
+                    return;
+            }
+            break;
+        }
+        case OpCodeId::Checkpoint:
+            checkpoints.append(state.instruction_position);
+            break;
+        case OpCodeId::FailIfEmpty:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckEnd:
+        case OpCodeId::CheckBoundary:
+        case OpCodeId::Exit:
+            break;
+        default:
+            return;
+        }
+        state.instruction_position += opcode.size();
+    }
+
+    // The fork that enters or leaves a loop sits on its boundary; any other fork inside it makes the loop ambiguous.
+    auto loop_body_can_fork = any_of(loops, [&](Loop const& loop) {
+        return any_of(forks, [&](auto fork) { return fork > loop.start && fork < loop.end; });
+    });
+    if (!loop_body_can_fork)
+        return;
+
+    // Empty checks are fine as long as they can never see an empty iteration: if a loop body could match the empty
+    // string, two threads reaching the same instruction at the same position could disagree on whether the current
+    // iteration is empty, and dropping one of them would change the result.
+    Vector<bool> visited;
+    Vector<size_t> worklist;
+    for (auto checkpoint_position : checkpoints) {
+        state.instruction_position = checkpoint_position;
+        auto& checkpoint = bytecode.get_opcode(state);
+        auto checkpoint_id = to<OpCode_Checkpoint>(checkpoint).id();
+
+        visited.clear_with_capacity();
+        visited.resize(bytecode_size + 1);
+        worklist.clear_with_capacity();
+        worklist.append(checkpoint_position + checkpoint.size());
+
+        while (!worklist.is_empty()) {
+            auto instruction_position = worklist.take_last();
+            if (instruction_position >= bytecode_size || visited[instruction_position])
+                continue;
+            visited[instruction_position] = true;
+
+            state.instruction_position = instruction_position;
+            auto& opcode = bytecode.get_opcode(state);
+            if (opcode.opcode_id() == OpCodeId::JumpNonEmpty && static_cast<size_t>(to<OpCode_JumpNonEmpty>(opcode).checkpoint()) == checkpoint_id)
+                return;
+            if (opcode.opcode_id() == OpCodeId::FailIfEmpty && to<OpCode_FailIfEmpty>(opcode).checkpoint() == checkpoint_id)
+                return;
+
+            for_each_empty_successor(instruction_position, [&](size_t successor) { worklist.append(successor); });
+        }
+    }
+
+    parser_result.optimization_data.can_use_pike_vm = true;
+}
+
 template<typename Parser>
 typename Regex<Parser>::BasicBlockList Regex<Parser>::split_basic_blocks(ByteCode const& bytecode)
 {
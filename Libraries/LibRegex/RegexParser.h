@@ -68,6 +68,8 @@ public:
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
             bool only_start_of_line = false;
+            // If set, the pattern can be matched in linear time by the Pike VM instead of the backtracking matcher.
+            bool can_use_pike_vm = false;
         } optimization_data {};
     };
 
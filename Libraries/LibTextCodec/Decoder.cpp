@@ -18,6 +18,49 @@ namespace TextCodec {
 
 static constexpr u32 replacement_code_point = 0xfffd;
 
+// Returns the length of the run of ASCII bytes at the start of the given bytes, checking a machine word at a time.
+static size_t ascii_run_length(ReadonlyBytes bytes)
+{
+    static constexpr FlatPtr non_ascii_mask = explode_byte(0x80);
+
+    size_t length = 0;
+    for (; length + sizeof(FlatPtr) <= bytes.size(); length += sizeof(FlatPtr)) {
+        FlatPtr word;
+        __builtin_memcpy(&word, bytes.offset_pointer(length), sizeof(word));
+        if (word & non_ascii_mask)
+            break;
+    }
+
+    while (length < bytes.size() && bytes[length] < 0x80)
+        ++length;
+
+    return length;
+}
+
+// Decodes an encoding in which every byte maps to exactly one code point and ASCII bytes map to themselves. Runs of
+// ASCII bytes are appended in bulk, and only the remaining bytes are looked up one at a time.
+template<typename DecodeNonASCIIByte>
+static ErrorOr<String> decode_single_byte_encoding_to_utf8(StringView input, DecodeNonASCIIByte decode_non_ascii_byte)
+{
+    if (input.is_ascii())
+        return String::from_utf8_without_validation(input.bytes());
+
+    StringBuilder builder(input.length());
+    auto bytes = input.bytes();
+
+    for (size_t index = 0; index < bytes.size();) {
+        if (auto length = ascii_run_length(bytes.slice(index)); length > 0) {
+            TRY(builder.try_append(input.substring_view(index, length)));
+            index += length;
+            continue;
+        }
+
+        TRY(builder.try_append_code_point(decode_non_ascii_byte(bytes[index++])));
+    }
+
+    return builder.to_string_without_validation();
+}
+
 namespace {
 
 Latin1Decoder s_latin1_decoder;
@@ -345,10 +388,45 @@ bool Decoder::validate(StringView input)
     return !result.is_error();
 }
 
+// Returns the end of the run of input starting at the given index that has to go through a decoder's state machine,
+// i.e. the first position after two consecutive ASCII bytes (or the end of the input). In every ASCII-compatible
+// encoding, an ASCII byte is either a complete character or the trail byte of one, and a trail byte that does not fit
+// is decoded again on its own. So after two ASCII bytes in a row, the decoder is always back in its initial state.
+static size_t end_of_non_ascii_run(ReadonlyBytes bytes, size_t index)
+{
+    for (; index + 1 < bytes.size(); ++index) {
+        if (bytes[index] < 0x80 && bytes[index + 1] < 0x80)
+            return index + 2;
+    }
+    return bytes.size();
+}
+
 ErrorOr<String> Decoder::to_utf8(StringView input)
 {
     StringBuilder builder(input.length());
-    TRY(process(input, [&builder](u32 c) { return builder.try_append_code_point(c); }));
+    auto on_code_point = [&builder](u32 c) { return builder.try_append_code_point(c); };
+
+    if (!is_ascii_compatible()) {
+        TRY(process(input, on_code_point));
+        return builder.to_string_without_validation();
+    }
+
+    if (input.is_ascii())
+        return String::from_utf8_without_validation(input.bytes());
+
+    auto bytes = input.bytes();
+    for (size_t index = 0; index < bytes.size();) {
+        if (auto length = ascii_run_length(bytes.slice(index)); length > 0) {
+            TRY(builder.try_append(input.substring_view(index, length)));
+            index += length;
+            continue;
+        }
+
+        auto end = end_of_non_ascii_run(bytes, index);
+        TRY(process(input.substring_view(index, end - index), on_code_point));
+        index = end;
+    }
+
     return builder.to_string_without_validation();
 }
 
@@ -408,6 +486,11 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<String> Latin1Decoder::to_utf8(StringView input)
+{
+    return decode_single_byte_encoding_to_utf8(input, [](u8 byte) -> u32 { return byte; });
+}
+
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     // PDF 1.7 spec, Appendix D.2 "PDFDocEncoding Character Set"
@@ -479,6 +562,11 @@ ErrorOr<void> XUserDefinedDecoder::process(StringView input, Function<ErrorOr<vo
     return {};
 }
 
+ErrorOr<String> XUserDefinedDecoder::to_utf8(StringView input)
+{
+    return decode_single_byte_encoding_to_utf8(input, [](u8 byte) -> u32 { return 0xF780 + byte - 0x80; });
+}
+
 // https://encoding.spec.whatwg.org/#single-byte-decoder
 template<Integral ArrayType>
 ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
@@ -502,6 +590,12 @@ ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<E
     return {};
 }
 
+template<Integral ArrayType>
+ErrorOr<String> SingleByteDecoder<ArrayType>::to_utf8(StringView input)
+{
+    return decode_single_byte_encoding_to_utf8(input, [this](u8 byte) -> u32 { return m_translation_table[byte - 0x80]; });
+}
+
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
 static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 {
@@ -1305,12 +1399,7 @@ String isomorphic_decode(StringView input)
     // To isomorphic decode a byte sequence input, return a string whose code point length is equal to input’s length
     // and whose code points have the same values as the values of input’s bytes, in the same order.
     // NB: This is essentially spec-speak for "Decode as ISO-8859-1 / Latin-1".
-    StringBuilder builder(input.length());
-
-    for (auto byte : input.bytes())
-        builder.append_code_point(byte);
-
-    return builder.to_string_without_validation();
+    return MUST(decode_single_byte_encoding_to_utf8(input, [](u8 byte) -> u32 { return byte; }));
 }
 
 }
@@ -24,6 +24,11 @@ public:
 protected:
     virtual ~Decoder() = default;
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) = 0;
+
+    // Whether every ASCII byte decodes to itself while the decoder is in its initial state, and is otherwise either
+    // consumed as a trail byte or decoded again on its own. This lets to_utf8() copy runs of ASCII input over in bulk,
+    // and only hand the input in between them to process().
+    virtual bool is_ascii_compatible() const { return false; }
 };
 
 class TEXTCODEC_API UTF8Decoder final : public Decoder {
@@ -60,6 +65,7 @@ public:
     }
 
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+    virtual ErrorOr<String> to_utf8(StringView) override;
 
 private:
     Array<ArrayType, 128> m_translation_table;
@@ -69,6 +75,7 @@ class TEXTCODEC_API Latin1Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override { return true; }
+    virtual ErrorOr<String> to_utf8(StringView) override;
 };
 
 class TEXTCODEC_API PDFDocEncodingDecoder final : public Decoder {
@@ -81,21 +88,31 @@ class TEXTCODEC_API XUserDefinedDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override { return true; }
+    virtual ErrorOr<String> to_utf8(StringView) override;
 };
 
 class TEXTCODEC_API GB18030Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+private:
+    virtual bool is_ascii_compatible() const override { return true; }
 };
 
 class TEXTCODEC_API Big5Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+private:
+    virtual bool is_ascii_compatible() const override { return true; }
 };
 
 class TEXTCODEC_API EUCJPDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+private:
+    virtual bool is_ascii_compatible() const override { return true; }
 };
 
 class TEXTCODEC_API ISO2022JPDecoder final : public Decoder {
@@ -106,11 +123,17 @@ public:
 class TEXTCODEC_API ShiftJISDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+private:
+    virtual bool is_ascii_compatible() const override { return true; }
 };
 
 class TEXTCODEC_API EUCKRDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+private:
+    virtual bool is_ascii_compatible() const override { return true; }
 };
 
 class TEXTCODEC_API ReplacementDecoder final : public Decoder {
@@ -6,6 +6,8 @@
  */
 
 #include <AK/Queue.h>
+#include <AK/Vector.h>
+#include <LibCore/System.h>
 #include <LibThreading/BackgroundAction.h>
 #include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
@@ -13,28 +15,30 @@
 static pthread_mutex_t s_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t s_condition = PTHREAD_COND_INITIALIZER;
 static Queue<Function<void()>>* s_all_actions;
-static Threading::Thread* s_background_thread;
+static Vector<NonnullRefPtr<Threading::Thread>>* s_background_threads;
 static Atomic<bool> s_background_thread_should_run = true;
 
+// Enough workers that one long action (e.g. a key derivation) does not hold up every other one, without starting a
+// thread per core in every process that uses background actions.
+static constexpr size_t max_background_thread_count = 4;
+
 static intptr_t background_thread_func()
 {
-    Vector<Function<void()>> actions;
-    while (s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire)) {
+    for (;;) {
         pthread_mutex_lock(&s_mutex);
 
         while (s_all_actions->is_empty() && s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire))
             pthread_cond_wait(&s_condition, &s_mutex);
 
-        while (!s_all_actions->is_empty())
-            actions.append(s_all_actions->dequeue());
+        if (!s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire)) {
+            pthread_mutex_unlock(&s_mutex);
+            break;
+        }
 
+        auto action = s_all_actions->dequeue();
         pthread_mutex_unlock(&s_mutex);
 
-        for (auto& action : actions) {
-            if (s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire))
-                action();
-        }
-        actions.clear();
+        action();
     }
     return 0;
 }
@@ -42,13 +46,19 @@ static intptr_t background_thread_func()
 static void init()
 {
     s_all_actions = new Queue<Function<void()>>;
-    s_background_thread = &Threading::Thread::construct("Background"sv, background_thread_func).leak_ref();
-    s_background_thread->start();
+    s_background_threads = new Vector<NonnullRefPtr<Threading::Thread>>;
+
+    auto thread_count = clamp<size_t>(Core::System::hardware_concurrency(), 2, max_background_thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        auto thread = Threading::Thread::construct("Background"sv, background_thread_func);
+        thread->start();
+        s_background_threads->append(move(thread));
+    }
 }
 
 void Threading::quit_background_thread()
 {
-    if (!s_background_thread)
+    if (!s_background_threads)
         return;
 
     s_background_thread_should_run.store(false, AK::MemoryOrder::memory_order_release);
@@ -57,23 +67,17 @@ void Threading::quit_background_thread()
     pthread_cond_broadcast(&s_condition);
     pthread_mutex_unlock(&s_mutex);
 
-    MUST(s_background_thread->join());
+    for (auto& thread : *s_background_threads)
+        MUST(thread->join());
 
     delete s_all_actions;
-    s_background_thread->unref();
+    delete s_background_threads;
     s_all_actions = nullptr;
-    s_background_thread = nullptr;
+    s_background_threads = nullptr;
 
     s_background_thread_should_run.store(true, AK::MemoryOrder::memory_order_release);
 }
 
-Threading::Thread& Threading::BackgroundActionBase::background_thread()
-{
-    if (s_background_thread == nullptr)
-        init();
-    return *s_background_thread;
-}
-
 void Threading::BackgroundActionBase::enqueue_work(Function<void()> work)
 {
     if (s_all_actions == nullptr)
@@ -81,6 +85,6 @@ void Threading::BackgroundActionBase::enqueue_work(Function<void()> work)
 
     pthread_mutex_lock(&s_mutex);
     s_all_actions->enqueue(move(work));
-    pthread_cond_broadcast(&s_condition);
+    pthread_cond_signal(&s_condition);
     pthread_mutex_unlock(&s_mutex);
 }
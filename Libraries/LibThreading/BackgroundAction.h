@@ -31,8 +31,8 @@ class BackgroundActionBase {
 private:
     BackgroundActionBase() = default;
 
+    // Runs work on one of a small pool of background threads. Work items may run concurrently and in any order.
     static void enqueue_work(ESCAPING Function<void()>);
-    static Thread& background_thread();
 };
 
 template<typename Result>
@@ -56,6 +56,12 @@ public:
 
     void associate_with_animation(GC::Ref<Animation>);
     void disassociate_with_animation(GC::Ref<Animation>);
+    ReadonlySpan<GC::Ref<Animation>> associated_animations() const
+    {
+        if (!m_impl)
+            return {};
+        return m_impl->associated_animations;
+    }
 
     void set_has_css_defined_animations();
     bool has_css_defined_animations() const;
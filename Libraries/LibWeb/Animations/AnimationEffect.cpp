@@ -9,6 +9,7 @@
 #include <LibWeb/Animations/Animation.h>
 #include <LibWeb/Animations/AnimationEffect.h>
 #include <LibWeb/Animations/AnimationTimeline.h>
+#include <LibWeb/Animations/KeyframeEffect.h>
 #include <LibWeb/Bindings/AnimationEffectPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/CSS/ComputedProperties.h>
@@ -807,6 +808,49 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_f
     return invalidation;
 }
 
+// Returns whether the rendering thread advances the given property of the element by itself, using the animations of
+// the cached display list.
+static bool is_running_on_compositor(DOM::Element const& element, CSS::PropertyID property_id)
+{
+    auto const& document = element.document();
+    if (!document.cached_display_list())
+        return false;
+
+    bool has_effect_for_property = false;
+    for (auto const& animation : element.associated_animations()) {
+        if (animation->is_idle())
+            continue;
+        auto const* effect = as_if<KeyframeEffect>(animation->effect().ptr());
+        if (!effect || effect->pseudo_element_type().has_value() || !effect->target_properties().contains(property_id))
+            continue;
+        if (!effect->is_running_on_compositor(property_id, document.display_list_generation()))
+            return false;
+        has_effect_for_property = true;
+    }
+    return has_effect_for_property;
+}
+
+static bool changed_properties_are_running_on_compositor(DOM::Element const& element, AnimationUpdateContext::ElementData::PropertyMap const& old_properties, AnimationUpdateContext::ElementData::PropertyMap const& new_properties)
+{
+    auto property_is_unchanged_or_running_on_compositor = [&](CSS::PropertyID property_id) {
+        auto old_value = old_properties.get(property_id);
+        auto new_value = new_properties.get(property_id);
+        if (old_value.has_value() && new_value.has_value() && *old_value.value() == *new_value.value())
+            return true;
+        return is_running_on_compositor(element, property_id);
+    };
+
+    for (auto const& [property_id, _] : old_properties) {
+        if (!property_is_unchanged_or_running_on_compositor(property_id))
+            return false;
+    }
+    for (auto const& [property_id, _] : new_properties) {
+        if (!old_properties.contains(property_id) && !is_running_on_compositor(element, property_id))
+            return false;
+    }
+    return true;
+}
+
 AnimationUpdateContext::~AnimationUpdateContext()
 {
     for (auto& it : elements) {
@@ -855,7 +899,16 @@ AnimationUpdateContext::~AnimationUpdateContext()
             if (invalidation.rebuild_accumulated_visual_contexts)
                 element.document().set_needs_accumulated_visual_contexts_update(true);
 
-            element.document().set_needs_display();
+            // OPTIMIZATION: If only properties that the rendering thread animates by itself have changed, the cached
+            //               display list still paints the right thing, and the rendering thread presents the new
+            //               frames on its own.
+            auto is_animated_by_rendering_thread = !invalidation.relayout
+                && !invalidation.rebuild_layout_tree
+                && !invalidation.rebuild_stacking_context_tree
+                && !element.pseudo_element().has_value()
+                && changed_properties_are_running_on_compositor(target, it.value->animated_properties_before_update, style->animated_property_values());
+            if (!is_animated_by_rendering_thread)
+                element.document().set_needs_display();
         }
         if (invalidation.rebuild_stacking_context_tree)
             element.document().invalidate_stacking_context_tree();
@@ -958,6 +958,52 @@ void KeyframeEffect::update_computed_properties(AnimationUpdateContext& context)
     target->document().style_computer().collect_animation_into(abstract_element, *this, *computed_properties);
 }
 
+KeyframeEffect::CompositorAnimationState KeyframeEffect::compositor_animation_state(u64 display_list_generation) const
+{
+    CompositorAnimationState state {
+        .display_list_generation = display_list_generation,
+        .start_time = {},
+        .playback_rate = 1.0,
+        .start_delay = m_start_delay,
+        .iteration_duration = m_iteration_duration,
+        .iteration_start = m_iteration_start,
+        .iteration_count = m_iteration_count,
+        .playback_direction = m_playback_direction,
+        .fill_mode = m_fill_mode,
+        .easing = m_timing_function.to_string(),
+        .key_frame_set = m_key_frame_set,
+    };
+    if (auto animation = associated_animation()) {
+        state.start_time = animation->start_time();
+        state.playback_rate = animation->playback_rate();
+    }
+    return state;
+}
+
+void KeyframeEffect::set_running_on_compositor(CSS::PropertyID property_id, CompositorAnimationState state)
+{
+    if (!m_compositor_animation_state.has_value() || *m_compositor_animation_state != state) {
+        m_compositor_animation_state = move(state);
+        m_properties_running_on_compositor.clear();
+    }
+    if (!m_properties_running_on_compositor.contains_slow(property_id))
+        m_properties_running_on_compositor.append(property_id);
+}
+
+bool KeyframeEffect::is_running_on_compositor(CSS::PropertyID property_id, u64 display_list_generation) const
+{
+    if (!m_properties_running_on_compositor.contains_slow(property_id))
+        return false;
+    return compositor_animation_state_is_current(display_list_generation);
+}
+
+bool KeyframeEffect::compositor_animation_state_is_current(u64 display_list_generation) const
+{
+    if (!m_compositor_animation_state.has_value())
+        return false;
+    return *m_compositor_animation_state == compositor_animation_state(display_list_generation);
+}
+
 Bindings::CompositeOperation css_animation_composition_to_bindings_composite_operation(CSS::AnimationComposition composition)
 {
     switch (composition) {
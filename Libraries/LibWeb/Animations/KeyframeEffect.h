@@ -113,6 +113,29 @@ public:
 
     virtual void update_computed_properties(AnimationUpdateContext&) override;
 
+    // Everything a copy of this effect running on the rendering thread was created from. While none of it changes,
+    // the rendering thread produces the same values for the copied properties as the style computer does, so changes
+    // to those properties do not require recording a new display list.
+    struct CompositorAnimationState {
+        u64 display_list_generation { 0 };
+        Optional<TimeValue> start_time;
+        double playback_rate { 1.0 };
+        TimeValue start_delay;
+        TimeValue iteration_duration;
+        double iteration_start { 0.0 };
+        double iteration_count { 1.0 };
+        Bindings::PlaybackDirection playback_direction { Bindings::PlaybackDirection::Normal };
+        Bindings::FillMode fill_mode { Bindings::FillMode::Auto };
+        String easing;
+        RefPtr<KeyFrameSet const> key_frame_set;
+
+        bool operator==(CompositorAnimationState const&) const = default;
+    };
+    CompositorAnimationState compositor_animation_state(u64 display_list_generation) const;
+    void set_running_on_compositor(CSS::PropertyID, CompositorAnimationState);
+    bool is_running_on_compositor(CSS::PropertyID, u64 display_list_generation) const;
+    bool compositor_animation_state_is_current(u64 display_list_generation) const;
+
 private:
     KeyframeEffect(JS::Realm&);
     virtual ~KeyframeEffect() override = default;
@@ -136,6 +159,9 @@ private:
     Vector<GC::Ref<JS::Object>> m_keyframe_objects {};
 
     RefPtr<KeyFrameSet const> m_key_frame_set {};
+
+    Optional<CompositorAnimationState> m_compositor_animation_state;
+    Vector<CSS::PropertyID, 2> m_properties_running_on_compositor;
 };
 
 }
@@ -13,6 +13,7 @@
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/WOFF/Loader.h>
 #include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibURL/Site.h>
 #include <LibWeb/CSS/CSSFontFaceRule.h>
 #include <LibWeb/CSS/CSSStyleSheet.h>
 #include <LibWeb/CSS/ComputedProperties.h>
@@ -27,6 +28,7 @@
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/MIME.h>
+#include <LibWeb/Fetch/Infrastructure/NetworkPartitionKey.h>
 #include <LibWeb/Fetch/Response.h>
 #include <LibWeb/MimeSniff/Resource.h>
 #include <LibWeb/Platform/FontPlugin.h>
@@ -211,6 +213,16 @@ void FontLoader::font_did_load_or_fail(RefPtr<Gfx::Typeface const> typeface)
     m_fetch_controller = nullptr;
 }
 
+Optional<String> web_font_cache_partition(HTML::Environment const& environment)
+{
+    // NB: Web fonts are shared between documents with the same top-level site, matching the partitioning of the HTTP
+    //     cache they were fetched through. An opaque top-level origin is never same site with anything else.
+    auto partition_key = Fetch::Infrastructure::determine_the_network_partition_key(environment);
+    if (partition_key.top_level_origin.is_opaque())
+        return {};
+    return URL::Site::obtain(partition_key.top_level_origin).serialize();
+}
+
 ErrorOr<NonnullRefPtr<Gfx::Typeface const>> FontLoader::try_load_font(Fetch::Infrastructure::Response const& response, ByteBuffer const& bytes)
 {
     // FIXME: This could maybe use the format() provided in @font-face as well, since often the mime type is just application/octet-stream and we have to try every format
@@ -218,25 +230,28 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface const>> FontLoader::try_load_font(Fetch::Inf
     if (!mime_type.has_value() || !mime_type->is_font()) {
         mime_type = MimeSniff::Resource::sniff(bytes, MimeSniff::SniffingConfiguration { .sniffing_context = MimeSniff::SniffingContext::Font });
     }
-    if (mime_type.has_value()) {
+    if (!mime_type.has_value())
+        return Error::from_string_literal("Automatic format detection failed");
+
+    auto partition = web_font_cache_partition(m_font_computer->document().relevant_settings_object());
+    return Gfx::FontDatabase::the().get_or_decode_web_font(bytes, partition, [&](ReadonlyBytes data) -> ErrorOr<NonnullRefPtr<Gfx::Typeface const>> {
         if (mime_type->essence() == "font/ttf"sv || mime_type->essence() == "application/x-font-ttf"sv || mime_type->essence() == "font/otf"sv) {
-            if (auto result = Gfx::Typeface::try_load_from_temporary_memory(bytes); !result.is_error()) {
-                return result;
+            if (auto result = Gfx::Typeface::try_load_from_temporary_memory(data); !result.is_error()) {
+                return result.release_value();
             }
         }
         if (mime_type->essence() == "font/woff"sv || mime_type->essence() == "application/font-woff"sv) {
-            if (auto result = WOFF::try_load_from_bytes(bytes); !result.is_error()) {
-                return result;
+            if (auto result = WOFF::try_load_from_bytes(data); !result.is_error()) {
+                return result.release_value();
             }
         }
         if (mime_type->essence() == "font/woff2"sv || mime_type->essence() == "application/font-woff2"sv) {
-            if (auto result = WOFF2::try_load_from_bytes(bytes); !result.is_error()) {
-                return result;
+            if (auto result = WOFF2::try_load_from_bytes(data); !result.is_error()) {
+                return result.release_value();
             }
         }
-    }
-
-    return Error::from_string_literal("Automatic format detection failed");
+        return Error::from_string_literal("Automatic format detection failed");
+    });
 }
 
 struct FontComputer::MatchingFontCandidate {
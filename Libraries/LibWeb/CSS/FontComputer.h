@@ -51,6 +51,10 @@ struct ComputedFontCacheKey {
     [[nodiscard]] bool operator==(ComputedFontCacheKey const& other) const = default;
 };
 
+// Returns the partition that decoded web fonts are shared under in Gfx::FontDatabase, or nothing if fonts loaded in
+// this environment must not be shared at all.
+Optional<String> web_font_cache_partition(HTML::Environment const&);
+
 class FontLoader final : public GC::Cell {
     GC_CELL(FontLoader, GC::Cell);
     GC_DECLARE_ALLOCATOR(FontLoader);
@@ -33,31 +33,33 @@
 
 namespace Web::CSS {
 
-static NonnullRefPtr<Core::Promise<NonnullRefPtr<Gfx::Typeface const>>> load_vector_font(JS::Realm& realm, ByteBuffer const& data)
+static NonnullRefPtr<Core::Promise<NonnullRefPtr<Gfx::Typeface const>>> load_vector_font(JS::Realm& realm, ByteBuffer const& data, Optional<String> partition)
 {
     auto promise = Core::Promise<NonnullRefPtr<Gfx::Typeface const>>::construct();
 
     // FIXME: 'Asynchronously' shouldn't mean 'later on the main thread'.
     //        Can we defer this to a background thread?
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&data, promise] {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&data, partition = move(partition), promise] {
         // FIXME: This should be de-duplicated with StyleComputer::FontLoader::try_load_font
         // We don't have the luxury of knowing the MIME type, so we have to try all formats.
-        auto ttf = Gfx::Typeface::try_load_from_externally_owned_memory(data);
-        if (!ttf.is_error()) {
-            promise->resolve(ttf.release_value());
-            return;
-        }
-        auto woff = WOFF::try_load_from_bytes(data);
-        if (!woff.is_error()) {
-            promise->resolve(woff.release_value());
-            return;
-        }
-        auto woff2 = WOFF2::try_load_from_bytes(data);
-        if (!woff2.is_error()) {
-            promise->resolve(woff2.release_value());
+        auto typeface = Gfx::FontDatabase::the().get_or_decode_web_font(data, partition, [](ReadonlyBytes data) -> ErrorOr<NonnullRefPtr<Gfx::Typeface const>> {
+            // NB: The decoded typeface may outlive this FontFace in the web font cache, so it must own its data.
+            auto ttf = Gfx::Typeface::try_load_from_temporary_memory(data);
+            if (!ttf.is_error())
+                return ttf.release_value();
+            auto woff = WOFF::try_load_from_bytes(data);
+            if (!woff.is_error())
+                return woff.release_value();
+            auto woff2 = WOFF2::try_load_from_bytes(data);
+            if (!woff2.is_error())
+                return woff2.release_value();
+            return Error::from_string_literal("Automatic format detection failed");
+        });
+        if (typeface.is_error()) {
+            promise->reject(typeface.release_error());
             return;
         }
-        promise->reject(Error::from_string_literal("Automatic format detection failed"));
+        promise->resolve(typeface.release_value());
     }));
 
     return promise;
@@ -149,7 +151,7 @@ GC::Ref<FontFace> FontFace::construct_impl(JS::Realm& realm, String family, Font
 
         // 3. Asynchronously, attempt to parse the data in it as a font.
         //    When this is completed, successfully or not, queue a task to run the following steps synchronously:
-        font_face->m_font_load_promise = load_vector_font(realm, font_face->m_binary_data);
+        font_face->m_font_load_promise = load_vector_font(realm, font_face->m_binary_data, web_font_cache_partition(HTML::relevant_settings_object(*font_face)));
 
         font_face->m_font_load_promise->when_resolved([font = GC::make_root(font_face)](auto const& vector_font) -> ErrorOr<void> {
             HTML::queue_global_task(HTML::Task::Source::FontLoading, HTML::relevant_global_object(*font), GC::create_function(font->heap(), [font = GC::Ref(*font), vector_font] {
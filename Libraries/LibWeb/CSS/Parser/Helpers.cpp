@@ -54,9 +54,9 @@ GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams cons
         style_sheet->set_source_text({});
         return style_sheet;
     }
-    auto style_sheet = CSS::Parser::Parser::create(context, css).parse_as_css_stylesheet(location, move(media_list));
-    // FIXME: Avoid this copy
-    style_sheet->set_source_text(MUST(String::from_utf8(css)));
+    auto contents = CSS::Parser::Parser::get_or_parse_shared_stylesheet_contents(css);
+    auto style_sheet = CSS::Parser::Parser::create(context, {}).convert_to_css_stylesheet(contents->rules, location, move(media_list));
+    style_sheet->set_source_text(contents->source_text);
     return style_sheet;
 }
 
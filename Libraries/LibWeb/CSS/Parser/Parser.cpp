@@ -173,12 +173,72 @@ GC::Ref<CSS::CSSStyleSheet> Parser::parse_as_css_stylesheet(Optional<::URL::URL>
     // To parse a CSS stylesheet, first parse a stylesheet.
     auto const& style_sheet = parse_a_stylesheet(m_token_stream, location);
 
-    auto rule_list = CSSRuleList::create(realm(), convert_rules(style_sheet.rules));
+    return convert_to_css_stylesheet(style_sheet.rules, move(location), move(media_list));
+}
+
+GC::Ref<CSS::CSSStyleSheet> Parser::convert_to_css_stylesheet(Vector<Rule> const& raw_rules, Optional<::URL::URL> location, GC::Ptr<MediaList> media_list)
+{
+    auto rule_list = CSSRuleList::create(realm(), convert_rules(raw_rules));
     if (!media_list)
         media_list = MediaList::create(realm(), {});
     return CSSStyleSheet::create(realm(), rule_list, *media_list, move(location));
 }
 
+// Stylesheets shorter than this are cheap to parse, and are mostly one-off inline <style> blocks that would only push
+// the interesting entries out of the cache.
+static constexpr size_t MINIMUM_SHARED_STYLE_SHEET_LENGTH = 1024;
+
+// Once the source text of all cached stylesheets adds up to more than this, the oldest ones are dropped from the cache.
+// A single stylesheet that is larger than this is not cached at all.
+static constexpr size_t MAXIMUM_SHARED_STYLE_SHEET_CACHE_SIZE = 8 * MiB;
+
+struct SharedStyleSheetContentsCache {
+    OrderedHashMap<String, NonnullRefPtr<Parser::SharedStyleSheetContents const>> entries;
+    size_t total_source_length { 0 };
+};
+
+static SharedStyleSheetContentsCache& shared_stylesheet_contents_cache()
+{
+    static SharedStyleSheetContentsCache cache;
+    return cache;
+}
+
+NonnullRefPtr<Parser::SharedStyleSheetContents const> Parser::get_or_parse_shared_stylesheet_contents(StringView css)
+{
+    auto& cache = shared_stylesheet_contents_cache();
+
+    auto parse = [&] {
+        auto contents = adopt_ref(*new SharedStyleSheetContents);
+        contents->source_text = MUST(String::from_utf8(css));
+        Parser parser { ParsingParams {}, Tokenizer::tokenize(contents->source_text, "utf-8"sv) };
+        contents->rules = parser.parse_a_stylesheets_contents(parser.m_token_stream);
+        return contents;
+    };
+
+    if (css.length() < MINIMUM_SHARED_STYLE_SHEET_LENGTH || css.length() > MAXIMUM_SHARED_STYLE_SHEET_CACHE_SIZE)
+        return parse();
+
+    if (auto it = cache.entries.find(css.hash(), [&](auto const& entry) { return entry.key == css; }); it != cache.entries.end())
+        return it->value;
+
+    auto contents = parse();
+    while (cache.total_source_length + css.length() > MAXIMUM_SHARED_STYLE_SHEET_CACHE_SIZE) {
+        auto oldest = cache.entries.begin();
+        cache.total_source_length -= oldest->key.bytes().size();
+        cache.entries.remove(oldest);
+    }
+    cache.entries.set(contents->source_text, contents);
+    cache.total_source_length += css.length();
+    return contents;
+}
+
+void Parser::clear_shared_stylesheet_contents_cache()
+{
+    auto& cache = shared_stylesheet_contents_cache();
+    cache.entries.clear();
+    cache.total_source_length = 0;
+}
+
 RefPtr<Supports> Parser::parse_as_supports()
 {
     return parse_a_supports(m_token_stream);
@@ -9,6 +9,7 @@
 
 #include <AK/Error.h>
 #include <AK/NonnullRawPtr.h>
+#include <AK/RefCounted.h>
 #include <AK/RefPtr.h>
 #include <AK/Vector.h>
 #include <LibGC/Ptr.h>
@@ -118,6 +119,18 @@ public:
 
     GC::RootVector<GC::Ref<CSSRule>> convert_rules(Vector<Rule> const& raw_rules);
     GC::Ref<CSS::CSSStyleSheet> parse_as_css_stylesheet(Optional<::URL::URL> location, GC::Ptr<MediaList> = {});
+    GC::Ref<CSS::CSSStyleSheet> convert_to_css_stylesheet(Vector<Rule> const& raw_rules, Optional<::URL::URL> location, GC::Ptr<MediaList> = {});
+
+    // Tokenizing a stylesheet and consuming its rules does not depend on the document it is parsed for, only on its
+    // source text. The resulting rules are kept in a per-process cache, so that stylesheets with the same text (e.g. a
+    // site's CSS bundle used by several documents or iframes) only go through that part of parsing once. Converting
+    // the rules into CSSRule objects still happens separately for each stylesheet.
+    struct SharedStyleSheetContents : public RefCounted<SharedStyleSheetContents> {
+        String source_text;
+        Vector<Rule> rules;
+    };
+    static NonnullRefPtr<SharedStyleSheetContents const> get_or_parse_shared_stylesheet_contents(StringView css);
+    static WEB_API void clear_shared_stylesheet_contents_cache();
 
     struct PropertiesAndCustomProperties {
         Vector<StyleProperty> properties;
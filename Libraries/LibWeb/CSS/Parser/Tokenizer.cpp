@@ -165,9 +165,15 @@ Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding)
         auto decoded_input = MUST(decoder->to_utf8(input));
 
         // OPTIMIZATION: If the input doesn't contain any filterable characters, we can skip the filtering
+        // NOTE: This checks the UTF-8 bytes directly, rather than decoding every code point. Surrogates are encoded as
+        //       0xED followed by a byte of at least 0xA0, and no other UTF-8 sequence starts that way.
         bool const contains_filterable = [&] {
-            for (auto code_point : decoded_input.code_points()) {
-                if (code_point == '\r' || code_point == '\f' || code_point == 0x00 || is_unicode_surrogate(code_point))
+            auto bytes = decoded_input.bytes();
+            for (size_t i = 0; i < bytes.size(); ++i) {
+                auto byte = bytes[i];
+                if (byte == '\r' || byte == '\f' || byte == 0x00)
+                    return true;
+                if (byte == 0xED && i + 1 < bytes.size() && bytes[i + 1] >= 0xA0)
                     return true;
             }
             return false;
@@ -438,7 +444,10 @@ Number Tokenizer::consume_a_number()
     // Execute the following steps in order:
 
     // 1. Initially set type to "integer". Let repr be the empty string.
-    StringBuilder repr;
+    // OPTIMIZATION: Everything appended to repr below is consumed from the input unchanged and in order, so repr is
+    //               always a contiguous run of the input. Rather than building it up a code point at a time, we take
+    //               it from the input once we're done.
+    auto repr_start_byte_offset = current_byte_offset();
     Number::Type type = Number::Type::Integer;
 
     // 2. If the next input code point is U+002B PLUS SIGN (+) or U+002D HYPHEN-MINUS (-),
@@ -447,7 +456,7 @@ Number Tokenizer::consume_a_number()
     auto next_input = peek_code_point();
     if (is_plus_sign(next_input) || is_hyphen_minus(next_input)) {
         has_explicit_sign = true;
-        repr.append_code_point(next_code_point());
+        (void)next_code_point();
     }
 
     // 3. While the next input code point is a digit, consume it and append it to repr.
@@ -456,7 +465,7 @@ Number Tokenizer::consume_a_number()
         if (!is_digit(digits))
             break;
 
-        repr.append_code_point(next_code_point());
+        (void)next_code_point();
     }
 
     // 4. If the next 2 input code points are U+002E FULL STOP (.) followed by a digit, then:
@@ -464,8 +473,8 @@ Number Tokenizer::consume_a_number()
     if (is_full_stop(maybe_number.first) && is_digit(maybe_number.second)) {
         // 1. Consume them.
         // 2. Append them to repr.
-        repr.append_code_point(next_code_point());
-        repr.append_code_point(next_code_point());
+        (void)next_code_point();
+        (void)next_code_point();
 
         // 3. Set type to "number".
         type = Number::Type::Number;
@@ -476,7 +485,7 @@ Number Tokenizer::consume_a_number()
             if (!is_digit(digit))
                 break;
 
-            repr.append_code_point(next_code_point());
+            (void)next_code_point();
         }
     }
 
@@ -491,13 +500,13 @@ Number Tokenizer::consume_a_number()
         // 2. Append them to repr.
         if (is_plus_sign(maybe_exp.second) || is_hyphen_minus(maybe_exp.second)) {
             if (is_digit(maybe_exp.third)) {
-                repr.append_code_point(next_code_point());
-                repr.append_code_point(next_code_point());
-                repr.append_code_point(next_code_point());
+                (void)next_code_point();
+                (void)next_code_point();
+                (void)next_code_point();
             }
         } else if (is_digit(maybe_exp.second)) {
-            repr.append_code_point(next_code_point());
-            repr.append_code_point(next_code_point());
+            (void)next_code_point();
+            (void)next_code_point();
         }
 
         // 3. Set type to "number".
@@ -509,12 +518,13 @@ Number Tokenizer::consume_a_number()
             if (!is_digit(digits))
                 break;
 
-            repr.append_code_point(next_code_point());
+            (void)next_code_point();
         }
     }
 
     // 6. Convert repr to a number, and set the value to the returned value.
-    auto value = convert_a_string_to_a_number(repr.string_view());
+    auto repr = m_utf8_view.as_string().substring_view(repr_start_byte_offset, current_byte_offset() - repr_start_byte_offset);
+    auto value = convert_a_string_to_a_number(repr);
 
     // 7. Return value and type.
     if (type == Number::Type::Integer && has_explicit_sign)
@@ -542,8 +552,20 @@ FlyString Tokenizer::consume_an_ident_sequence()
     // If that is the intended use, ensure that the stream starts with an ident sequence before
     // calling this algorithm.
 
+    // OPTIMIZATION: Most ident sequences are plain ASCII without any escapes. Find the run of ASCII name code points
+    //               directly in the input bytes, and if nothing that needs more care follows it, that run is the result.
+    auto remaining = remaining_input();
+    size_t ascii_length = 0;
+    while (ascii_length < remaining.length() && is_ascii(remaining[ascii_length]) && is_ident_code_point(remaining[ascii_length]))
+        ++ascii_length;
+    auto ascii_prefix = remaining.substring_view(0, ascii_length);
+    consume_bytes_without_newlines(ascii_length);
+    if (ascii_length == remaining.length() || (is_ascii(remaining[ascii_length]) && !is_reverse_solidus(remaining[ascii_length])))
+        return FlyString::from_utf8_without_validation(ascii_prefix.bytes());
+
     // Let result initially be an empty string.
     StringBuilder result;
+    result.append(ascii_prefix);
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
@@ -702,7 +724,17 @@ void Tokenizer::consume_the_remnants_of_a_bad_url()
 
 void Tokenizer::consume_as_much_whitespace_as_possible()
 {
-    while (is_whitespace(peek_code_point())) {
+    for (;;) {
+        // OPTIMIZATION: Skip over runs of spaces and tabs a byte at a time. Only newlines need to go through
+        //               next_code_point(), as they move us to the next line.
+        auto remaining = remaining_input();
+        size_t length = 0;
+        while (length < remaining.length() && (remaining[length] == ' ' || remaining[length] == '\t'))
+            ++length;
+        consume_bytes_without_newlines(length);
+
+        if (!is_whitespace(peek_code_point()))
+            return;
         (void)next_code_point();
     }
 }
@@ -872,7 +904,27 @@ Token Tokenizer::consume_string_token(u32 ending_code_point)
 
     // Initially create a <string-token> with its value set to the empty string.
     auto original_source_text_start_byte_offset_including_quotation_mark = current_byte_offset() - 1;
+
+    // OPTIMIZATION: Most strings contain no escapes or newlines, so their value can be taken straight from the input.
+    //               The ending code point, reverse solidus and newline are all ASCII, and so can never be part of a
+    //               multi-byte UTF-8 sequence, which lets us scan for them byte by byte.
+    auto remaining = remaining_input();
+    size_t plain_length = 0;
+    while (plain_length < remaining.length()) {
+        auto byte = static_cast<u8>(remaining[plain_length]);
+        if (byte == ending_code_point || is_reverse_solidus(byte) || is_newline(byte))
+            break;
+        ++plain_length;
+    }
+    auto plain_prefix = remaining.substring_view(0, plain_length);
+    consume_bytes_without_newlines(plain_length);
+    if (plain_length < remaining.length() && remaining[plain_length] == static_cast<char>(ending_code_point)) {
+        (void)next_code_point();
+        return Token::create_string(FlyString::from_utf8_without_validation(plain_prefix.bytes()), input_since(original_source_text_start_byte_offset_including_quotation_mark));
+    }
+
     StringBuilder builder;
+    builder.append(plain_prefix);
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
@@ -1237,4 +1289,35 @@ String Tokenizer::input_since(size_t offset) const
     return MUST(m_decoded_input.substring_from_byte_offset_with_shared_superstring(offset, current_byte_offset() - offset));
 }
 
+StringView Tokenizer::remaining_input() const
+{
+    return m_utf8_view.as_string().substring_view(current_byte_offset());
+}
+
+void Tokenizer::consume_bytes_without_newlines(size_t byte_count)
+{
+    if (byte_count == 0)
+        return;
+
+    auto const* bytes = m_utf8_iterator.ptr();
+    size_t code_point_count = 0;
+    size_t last_code_point_byte_offset = 0;
+    for (size_t i = 0; i < byte_count; ++i) {
+        ASSERT(!is_newline(bytes[i]));
+        // Count every byte that is not a UTF-8 continuation byte.
+        if ((bytes[i] & 0xC0) != 0x80) {
+            ++code_point_count;
+            last_code_point_byte_offset = i;
+        }
+    }
+
+    // Leave things as if the last of these code points had been consumed with next_code_point(), so that it can be
+    // reconsumed.
+    auto start_byte_offset = current_byte_offset();
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(start_byte_offset + last_code_point_byte_offset);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(start_byte_offset + byte_count);
+    m_position.column += code_point_count;
+    m_prev_position = { m_position.line, m_position.column - 1 };
+}
+
 }
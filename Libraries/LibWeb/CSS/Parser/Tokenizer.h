@@ -71,6 +71,10 @@ private:
 
     size_t current_byte_offset() const;
     String input_since(size_t offset) const;
+    StringView remaining_input() const;
+
+    // Consumes the given number of bytes at once, which must end on a code point boundary and must not contain a newline.
+    void consume_bytes_without_newlines(size_t byte_count);
 
     [[nodiscard]] u32 next_code_point();
     [[nodiscard]] u32 peek_code_point(size_t offset = 0) const;
@@ -13,7 +13,6 @@
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
-#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/HTML/CustomElements/CustomStateSet.h>
@@ -268,7 +267,7 @@ static inline bool matches_indeterminate_pseudo_class(DOM::Element const& elemen
     return false;
 }
 
-static inline void for_each_matching_attribute(CSS::Selector::SimpleSelector::Attribute const& attribute_selector, GC::Ptr<CSS::CSSStyleSheet const> style_sheet_for_rule, DOM::Element const& element, Function<IterationDecision(DOM::Attr const&)> const& process_attribute)
+static inline void for_each_matching_attribute(CSS::Selector::SimpleSelector::Attribute const& attribute_selector, GC::Ptr<CSS::CSSStyleSheet const> style_sheet_for_rule, DOM::Element const& element, Function<IterationDecision(DOM::AttributeList::Entry const&)> const& process_attribute)
 {
     auto const& qualified_name = attribute_selector.qualified_name;
     auto const& attribute_name = qualified_name.name.name;
@@ -278,8 +277,8 @@ static inline void for_each_matching_attribute(CSS::Selector::SimpleSelector::At
     //  therefore attribute selectors without a namespace component apply only to attributes that have no namespace (equivalent to "|attr")"
     case CSS::Selector::SimpleSelector::QualifiedName::NamespaceType::Default:
     case CSS::Selector::SimpleSelector::QualifiedName::NamespaceType::None:
-        if (auto const* attribute = element.attributes()->get_attribute(attribute_name))
-            (void)process_attribute(*attribute);
+        if (auto index = element.attribute_list().find_by_name(attribute_name); index.has_value())
+            (void)process_attribute(element.attribute_list().at(*index));
         return;
     case CSS::Selector::SimpleSelector::QualifiedName::NamespaceType::Any: {
         // When comparing the name part of a CSS attribute selector to the names of attributes on HTML elements in HTML
@@ -289,13 +288,12 @@ static inline void for_each_matching_attribute(CSS::Selector::SimpleSelector::At
         // https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
         bool const case_insensitive = element.document().is_html_document() && element.namespace_uri() == Namespace::HTML;
 
-        for (auto i = 0u; i < element.attributes()->length(); ++i) {
-            auto const* attr = element.attributes()->item(i);
+        for (auto const& attr : element.attribute_list()) {
             bool matches = case_insensitive
-                ? attr->local_name().equals_ignoring_ascii_case(attribute_name)
-                : attr->local_name() == attribute_name;
+                ? attr.local_name().equals_ignoring_ascii_case(attribute_name)
+                : attr.local_name() == attribute_name;
             if (matches) {
-                if (process_attribute(*attr) == IterationDecision::Break)
+                if (process_attribute(attr) == IterationDecision::Break)
                     break;
             }
         }
@@ -308,14 +306,14 @@ static inline void for_each_matching_attribute(CSS::Selector::SimpleSelector::At
         if (!selector_namespace.has_value())
             return;
 
-        if (auto const* attribute = element.attributes()->get_attribute_ns(selector_namespace, attribute_name))
-            (void)process_attribute(*attribute);
+        if (auto index = element.attribute_list().find_by_namespace(selector_namespace, attribute_name); index.has_value())
+            (void)process_attribute(element.attribute_list().at(*index));
         return;
     }
     VERIFY_NOT_REACHED();
 }
 
-static bool matches_single_attribute(CSS::Selector::SimpleSelector::Attribute const& attribute_selector, DOM::Attr const& attribute, CaseSensitivity case_sensitivity)
+static bool matches_single_attribute(CSS::Selector::SimpleSelector::Attribute const& attribute_selector, DOM::AttributeList::Entry const& attribute, CaseSensitivity case_sensitivity)
 {
     auto const case_insensitive_match = case_sensitivity == CaseSensitivity::CaseInsensitive;
 
@@ -415,7 +413,7 @@ static inline bool matches_attribute(CSS::Selector::SimpleSelector::Attribute co
     }(attribute.case_type);
 
     bool found_matching_attribute = false;
-    for_each_matching_attribute(attribute, style_sheet_for_rule, element, [&attribute, case_sensitivity, &found_matching_attribute](DOM::Attr const& attr) {
+    for_each_matching_attribute(attribute, style_sheet_for_rule, element, [&attribute, case_sensitivity, &found_matching_attribute](DOM::AttributeList::Entry const& attr) {
         if (matches_single_attribute(attribute, attr, case_sensitivity)) {
             found_matching_attribute = true;
             return IterationDecision::Break;
@@ -98,9 +98,8 @@ ValueComparingNonnullRefPtr<TransformationStyleValue const> TransformationStyleV
     return create(PropertyID::Transform, transform_function, identity_parameters());
 }
 
-ErrorOr<FloatMatrix4x4> TransformationStyleValue::to_matrix(Optional<Painting::PaintableBox const&> paintable_box) const
+ErrorOr<TransformationStyleValue::ResolvedArguments> TransformationStyleValue::resolve_arguments(Optional<Painting::PaintableBox const&> paintable_box) const
 {
-    auto count = m_properties.values.size();
     auto function_metadata = transform_function_metadata(m_properties.transform_function);
 
     auto length_to_px = [&](Length const& length) -> ErrorOr<float> {
@@ -197,15 +196,51 @@ ErrorOr<FloatMatrix4x4> TransformationStyleValue::to_matrix(Optional<Painting::P
         height = reference_box.height();
     }
 
-    switch (m_properties.transform_function) {
+    // Percentages in the translation functions refer to the size of the reference box.
+    auto reference_length_for_argument = [&](size_t argument_index) -> Optional<CSSPixels> {
+        switch (m_properties.transform_function) {
+        case TransformFunction::Translate:
+        case TransformFunction::Translate3d:
+            if (argument_index == 0)
+                return width;
+            if (argument_index == 1)
+                return height;
+            return {};
+        case TransformFunction::TranslateX:
+            return width;
+        case TransformFunction::TranslateY:
+            return height;
+        default:
+            return {};
+        }
+    };
+
+    ResolvedArguments arguments;
+    arguments.ensure_capacity(m_properties.values.size());
+    for (size_t i = 0; i < m_properties.values.size(); ++i)
+        arguments.unchecked_append(TRY(get_value(i, reference_length_for_argument(i))));
+    return arguments;
+}
+
+ErrorOr<FloatMatrix4x4> TransformationStyleValue::to_matrix(Optional<Painting::PaintableBox const&> paintable_box) const
+{
+    // https://drafts.csswg.org/css-transforms-2/#perspective
+    if (m_properties.transform_function == TransformFunction::Perspective && m_properties.values.size() == 1 && m_properties.values.first()->to_keyword() == Keyword::None)
+        return FloatMatrix4x4::identity();
+
+    return to_matrix(m_properties.transform_function, TRY(resolve_arguments(paintable_box)));
+}
+
+FloatMatrix4x4 TransformationStyleValue::to_matrix(TransformFunction transform_function, ReadonlySpan<float> arguments)
+{
+    auto count = arguments.size();
+
+    switch (transform_function) {
     case TransformFunction::Perspective:
         // https://drafts.csswg.org/css-transforms-2/#perspective
         if (count == 1) {
-            if (m_properties.values.first()->to_keyword() == Keyword::None)
-                return FloatMatrix4x4::identity();
-
             // FIXME: Add support for the 'perspective-origin' CSS property.
-            auto distance = TRY(get_value(0));
+            auto distance = arguments[0];
             // If the depth value is less than '1px', it must be treated as '1px' for the purpose of rendering, for
             // computing the resolved value of 'transform', and when used as the endpoint of interpolation.
             // Note: The intent of the above rules on values less than '1px' is that they cover the cases where
@@ -220,39 +255,39 @@ ErrorOr<FloatMatrix4x4> TransformationStyleValue::to_matrix(Optional<Painting::P
         break;
     case TransformFunction::Matrix:
         if (count == 6)
-            return FloatMatrix4x4(TRY(get_value(0)), TRY(get_value(2)), 0, TRY(get_value(4)),
-                TRY(get_value(1)), TRY(get_value(3)), 0, TRY(get_value(5)),
+            return FloatMatrix4x4(arguments[0], arguments[2], 0, arguments[4],
+                arguments[1], arguments[3], 0, arguments[5],
                 0, 0, 1, 0,
                 0, 0, 0, 1);
         break;
     case TransformFunction::Matrix3d:
         if (count == 16)
-            return FloatMatrix4x4(TRY(get_value(0)), TRY(get_value(4)), TRY(get_value(8)), TRY(get_value(12)),
-                TRY(get_value(1)), TRY(get_value(5)), TRY(get_value(9)), TRY(get_value(13)),
-                TRY(get_value(2)), TRY(get_value(6)), TRY(get_value(10)), TRY(get_value(14)),
-                TRY(get_value(3)), TRY(get_value(7)), TRY(get_value(11)), TRY(get_value(15)));
+            return FloatMatrix4x4(arguments[0], arguments[4], arguments[8], arguments[12],
+                arguments[1], arguments[5], arguments[9], arguments[13],
+                arguments[2], arguments[6], arguments[10], arguments[14],
+                arguments[3], arguments[7], arguments[11], arguments[15]);
         break;
     case TransformFunction::Translate:
         if (count == 1)
-            return FloatMatrix4x4(1, 0, 0, TRY(get_value(0, width)),
+            return FloatMatrix4x4(1, 0, 0, arguments[0],
                 0, 1, 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1);
         if (count == 2)
-            return FloatMatrix4x4(1, 0, 0, TRY(get_value(0, width)),
-                0, 1, 0, TRY(get_value(1, height)),
+            return FloatMatrix4x4(1, 0, 0, arguments[0],
+                0, 1, 0, arguments[1],
                 0, 0, 1, 0,
                 0, 0, 0, 1);
         break;
     case TransformFunction::Translate3d:
-        return FloatMatrix4x4(1, 0, 0, TRY(get_value(0, width)),
-            0, 1, 0, TRY(get_value(1, height)),
-            0, 0, 1, TRY(get_value(2)),
+        return FloatMatrix4x4(1, 0, 0, arguments[0],
+            0, 1, 0, arguments[1],
+            0, 0, 1, arguments[2],
             0, 0, 0, 1);
         break;
     case TransformFunction::TranslateX:
         if (count == 1)
-            return FloatMatrix4x4(1, 0, 0, TRY(get_value(0, width)),
+            return FloatMatrix4x4(1, 0, 0, arguments[0],
                 0, 1, 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1);
@@ -260,7 +295,7 @@ ErrorOr<FloatMatrix4x4> TransformationStyleValue::to_matrix(Optional<Painting::P
     case TransformFunction::TranslateY:
         if (count == 1)
             return FloatMatrix4x4(1, 0, 0, 0,
-                0, 1, 0, TRY(get_value(0, height)),
+                0, 1, 0, arguments[0],
                 0, 0, 1, 0,
                 0, 0, 0, 1);
         break;
@@ -268,31 +303,31 @@ ErrorOr<FloatMatrix4x4> TransformationStyleValue::to_matrix(Optional<Painting::P
         if (count == 1)
             return FloatMatrix4x4(1, 0, 0, 0,
                 0, 1, 0, 0,
-                0, 0, 1, TRY(get_value(0)),
+                0, 0, 1, arguments[0],
                 0, 0, 0, 1);
         break;
     case TransformFunction::Scale:
         if (count == 1)
-            return FloatMatrix4x4(TRY(get_value(0)), 0, 0, 0,
-                0, TRY(get_value(0)), 0, 0,
+            return FloatMatrix4x4(arguments[0], 0, 0, 0,
+                0, arguments[0], 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1);
         if (count == 2)
-            return FloatMatrix4x4(TRY(get_value(0)), 0, 0, 0,
-                0, TRY(get_value(1)), 0, 0,
+            return FloatMatrix4x4(arguments[0], 0, 0, 0,
+                0, arguments[1], 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1);
         break;
     case TransformFunction::Scale3d:
         if (count == 3)
-            return FloatMatrix4x4(TRY(get_value(0)), 0, 0, 0,
-                0, TRY(get_value(1)), 0, 0,
-                0, 0, TRY(get_value(2)), 0,
+            return FloatMatrix4x4(arguments[0], 0, 0, 0,
+                0, arguments[1], 0, 0,
+                0, 0, arguments[2], 0,
                 0, 0, 0, 1);
         break;
     case TransformFunction::ScaleX:
         if (count == 1)
-            return FloatMatrix4x4(TRY(get_value(0)), 0, 0, 0,
+            return FloatMatrix4x4(arguments[0], 0, 0, 0,
                 0, 1, 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1);
@@ -300,7 +335,7 @@ ErrorOr<FloatMatrix4x4> TransformationStyleValue::to_matrix(Optional<Painting::P
     case TransformFunction::ScaleY:
         if (count == 1)
             return FloatMatrix4x4(1, 0, 0, 0,
-                0, TRY(get_value(0)), 0, 0,
+                0, arguments[0], 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1);
         break;
@@ -308,46 +343,46 @@ ErrorOr<FloatMatrix4x4> TransformationStyleValue::to_matrix(Optional<Painting::P
         if (count == 1)
             return FloatMatrix4x4(1, 0, 0, 0,
                 0, 1, 0, 0,
-                0, 0, TRY(get_value(0)), 0,
+                0, 0, arguments[0], 0,
                 0, 0, 0, 1);
         break;
     case TransformFunction::Rotate3d:
         if (count == 4) {
-            auto axis = FloatVector3 { TRY(get_value(0)), TRY(get_value(1)), TRY(get_value(2)) };
+            auto axis = FloatVector3 { arguments[0], arguments[1], arguments[2] };
             auto epsilon = 1e-5f;
             if (axis.length() < epsilon)
                 return FloatMatrix4x4::identity();
-            return Gfx::rotation_matrix(axis.normalized(), TRY(get_value(3)));
+            return Gfx::rotation_matrix(axis.normalized(), arguments[3]);
         }
         break;
     case TransformFunction::RotateX:
         if (count == 1)
-            return Gfx::rotation_matrix({ 1.0f, 0.0f, 0.0f }, TRY(get_value(0)));
+            return Gfx::rotation_matrix({ 1.0f, 0.0f, 0.0f }, arguments[0]);
         break;
     case TransformFunction::RotateY:
         if (count == 1)
-            return Gfx::rotation_matrix({ 0.0f, 1.0f, 0.0f }, TRY(get_value(0)));
+            return Gfx::rotation_matrix({ 0.0f, 1.0f, 0.0f }, arguments[0]);
         break;
     case TransformFunction::Rotate:
     case TransformFunction::RotateZ:
         if (count == 1)
-            return Gfx::rotation_matrix({ 0.0f, 0.0f, 1.0f }, TRY(get_value(0)));
+            return Gfx::rotation_matrix({ 0.0f, 0.0f, 1.0f }, arguments[0]);
         break;
     case TransformFunction::Skew:
         if (count == 1)
-            return FloatMatrix4x4(1, tanf(TRY(get_value(0))), 0, 0,
+            return FloatMatrix4x4(1, tanf(arguments[0]), 0, 0,
                 0, 1, 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1);
         if (count == 2)
-            return FloatMatrix4x4(1, tanf(TRY(get_value(0))), 0, 0,
-                tanf(TRY(get_value(1))), 1, 0, 0,
+            return FloatMatrix4x4(1, tanf(arguments[0]), 0, 0,
+                tanf(arguments[1]), 1, 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1);
         break;
     case TransformFunction::SkewX:
         if (count == 1)
-            return FloatMatrix4x4(1, tanf(TRY(get_value(0))), 0, 0,
+            return FloatMatrix4x4(1, tanf(arguments[0]), 0, 0,
                 0, 1, 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1);
@@ -355,12 +390,12 @@ ErrorOr<FloatMatrix4x4> TransformationStyleValue::to_matrix(Optional<Painting::P
     case TransformFunction::SkewY:
         if (count == 1)
             return FloatMatrix4x4(1, 0, 0, 0,
-                tanf(TRY(get_value(0))), 1, 0, 0,
+                tanf(arguments[0]), 1, 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1);
         break;
     }
-    dbgln_if(LIBWEB_CSS_DEBUG, "FIXME: Unhandled transformation function {} with {} arguments", CSS::to_string(m_properties.transform_function), m_properties.values.size());
+    dbgln_if(LIBWEB_CSS_DEBUG, "FIXME: Unhandled transformation function {} with {} arguments", CSS::to_string(transform_function), count);
     return FloatMatrix4x4::identity();
 }
 
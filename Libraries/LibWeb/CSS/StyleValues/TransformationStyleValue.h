@@ -30,6 +30,12 @@ public:
 
     ErrorOr<FloatMatrix4x4> to_matrix(Optional<Painting::PaintableBox const&>) const;
 
+    // The arguments of the function as plain numbers: lengths in CSS pixels, angles in radians. Unlike style values,
+    // these can be safely handed to another thread and turned into a matrix there.
+    using ResolvedArguments = Vector<float, 16>;
+    ErrorOr<ResolvedArguments> resolve_arguments(Optional<Painting::PaintableBox const&>) const;
+    static FloatMatrix4x4 to_matrix(TransformFunction, ReadonlySpan<float> arguments);
+
     virtual void serialize(StringBuilder&, SerializationMode) const override;
     ErrorOr<GC::Ref<CSSTransformComponent>> reify_a_transform_function(JS::Realm&) const;
 
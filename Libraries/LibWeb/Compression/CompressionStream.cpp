@@ -11,12 +11,16 @@
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/TypedArray.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Compression/CompressionStream.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Streams/TransformStream.h>
 #include <LibWeb/Streams/TransformStreamOperations.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Compression {
 
@@ -52,28 +56,12 @@ WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::construct_imp
     // 3. Let transformAlgorithm be an algorithm which takes a chunk argument and runs the compress and enqueue a chunk
     //    algorithm with this and chunk.
     auto transform_algorithm = GC::create_function(realm.heap(), [stream](JS::Value chunk) -> GC::Ref<WebIDL::Promise> {
-        auto& realm = stream->realm();
-        auto& vm = realm.vm();
-
-        if (auto result = stream->compress_and_enqueue_chunk(chunk); result.is_error()) {
-            auto throw_completion = Bindings::exception_to_throw_completion(vm, result.exception());
-            return WebIDL::create_rejected_promise(realm, throw_completion.release_value());
-        }
-
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return stream->compress_and_enqueue_chunk(chunk);
     });
 
     // 4. Let flushAlgorithm be an algorithm which takes no argument and runs the compress flush and enqueue algorithm with this.
     auto flush_algorithm = GC::create_function(realm.heap(), [stream]() -> GC::Ref<WebIDL::Promise> {
-        auto& realm = stream->realm();
-        auto& vm = realm.vm();
-
-        if (auto result = stream->compress_flush_and_enqueue(); result.is_error()) {
-            auto throw_completion = Bindings::exception_to_throw_completion(vm, result.exception());
-            return WebIDL::create_rejected_promise(realm, throw_completion.release_value());
-        }
-
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return stream->compress_flush_and_enqueue();
     });
 
     // 6. Set up this's transform with transformAlgorithm set to transformAlgorithm and flushAlgorithm set to flushAlgorithm.
@@ -105,60 +93,82 @@ void CompressionStream::visit_edges(JS::Cell::Visitor& visitor)
 }
 
 // https://compression.spec.whatwg.org/#compress-and-enqueue-a-chunk
-WebIDL::ExceptionOr<void> CompressionStream::compress_and_enqueue_chunk(JS::Value chunk)
+GC::Ref<WebIDL::Promise> CompressionStream::compress_and_enqueue_chunk(JS::Value chunk)
 {
     auto& realm = this->realm();
 
     // 1. If chunk is not a BufferSource type, then throw a TypeError.
     if (!WebIDL::is_buffer_source_type(chunk))
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"sv };
-
-    // 2. Let buffer be the result of compressing chunk with cs's format and context.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
-        return compress(chunk_buffer, Finish::No);
-    }();
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", maybe_buffer.error())) };
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"sv });
 
-    auto buffer = maybe_buffer.release_value();
+    auto chunk_buffer = WebIDL::get_buffer_source_copy(chunk.as_object());
+    if (chunk_buffer.is_error())
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", chunk_buffer.error())) });
 
+    // 2. Let buffer be the result of compressing chunk with cs's format and context.
     // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
     // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
     // 5. For each Uint8Array array, enqueue array in cs's transform.
-    TRY(Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array));
-    return {};
+    return compress_and_enqueue_in_parallel(chunk_buffer.release_value(), Finish::No);
 }
 
 // https://compression.spec.whatwg.org/#compress-flush-and-enqueue
-WebIDL::ExceptionOr<void> CompressionStream::compress_flush_and_enqueue()
+GC::Ref<WebIDL::Promise> CompressionStream::compress_flush_and_enqueue()
+{
+    // 1. Let buffer be the result of compressing an empty input with cs's format and context, with the finish flag.
+    // 2. If buffer is empty, return.
+    // 3. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+    // 4. For each Uint8Array array, enqueue array in cs's transform.
+    return compress_and_enqueue_in_parallel({}, Finish::Yes);
+}
+
+// Compressing a large chunk can take a long time, so we do it on a background thread and only come back to the event
+// loop to enqueue the result. The transform stream does not hand us the next chunk (or flush) until the returned
+// promise settles, so chunks are compressed in order, one at a time, and backpressure propagates as before.
+GC::Ref<WebIDL::Promise> CompressionStream::compress_and_enqueue_in_parallel(ByteBuffer bytes, Finish finish)
 {
     auto& realm = this->realm();
+    auto promise = WebIDL::create_promise(realm);
 
-    // 1. Let buffer be the result of compressing an empty input with cs's format and context, with the finish flag.
-    auto maybe_buffer = compress({}, Finish::Yes);
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress flush: {}", maybe_buffer.error())) };
+    auto stream = GC::make_root(*this);
+    auto promise_root = GC::make_root(promise);
 
-    auto buffer = maybe_buffer.release_value();
+    auto settle_promise = [stream, promise_root, finish](ErrorOr<ByteBuffer> buffer) {
+        auto& realm = stream->realm();
 
-    // 2. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
+        // NB: The Compression spec does not define a task source, so we use the DOM manipulation task source.
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, stream = GC::Ref { *stream }, promise = GC::Ref { *promise_root }, finish, buffer = move(buffer)]() mutable {
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
 
-    // 3. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+            if (buffer.is_error()) {
+                auto message = MUST(String::formatted("Unable to compress {}: {}", finish == Finish::Yes ? "flush"sv : "chunk"sv, buffer.error()));
+                WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, move(message) }).release_value());
+                return;
+            }
 
-    // 4. For each Uint8Array array, enqueue array in cs's transform.
-    TRY(Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array));
-    return {};
+            if (auto result = stream->enqueue(buffer.release_value()); result.is_error()) {
+                WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
+                return;
+            }
+
+            WebIDL::resolve_promise(realm, promise, JS::js_undefined());
+        }));
+    };
+
+    // NB: Only the compressor is touched off the event loop. The root keeps this stream alive until the work is done.
+    (void)Threading::BackgroundAction<ByteBuffer>::construct(
+        [stream, bytes = move(bytes), finish](auto&) {
+            return stream->compress(bytes, finish);
+        },
+        [settle_promise](ByteBuffer buffer) -> ErrorOr<void> {
+            settle_promise(move(buffer));
+            return {};
+        },
+        [settle_promise](Error error) {
+            settle_promise(move(error));
+        });
+
+    return promise;
 }
 
 ErrorOr<ByteBuffer> CompressionStream::compress(ReadonlyBytes bytes, Finish finish)
@@ -179,4 +189,21 @@ ErrorOr<ByteBuffer> CompressionStream::compress(ReadonlyBytes bytes, Finish fini
     return buffer;
 }
 
+WebIDL::ExceptionOr<void> CompressionStream::enqueue(ByteBuffer buffer)
+{
+    auto& realm = this->realm();
+
+    // If buffer is empty, return.
+    if (buffer.is_empty())
+        return {};
+
+    // Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
+    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+
+    // For each Uint8Array array, enqueue array in cs's transform.
+    TRY(Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array));
+    return {};
+}
+
 }
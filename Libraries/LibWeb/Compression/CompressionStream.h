@@ -41,14 +41,16 @@ private:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
-    WebIDL::ExceptionOr<void> compress_and_enqueue_chunk(JS::Value);
-    WebIDL::ExceptionOr<void> compress_flush_and_enqueue();
+    GC::Ref<WebIDL::Promise> compress_and_enqueue_chunk(JS::Value);
+    GC::Ref<WebIDL::Promise> compress_flush_and_enqueue();
 
     enum class Finish {
         No,
         Yes,
     };
+    GC::Ref<WebIDL::Promise> compress_and_enqueue_in_parallel(ByteBuffer, Finish);
     ErrorOr<ByteBuffer> compress(ReadonlyBytes, Finish);
+    WebIDL::ExceptionOr<void> enqueue(ByteBuffer);
 
     Compressor m_compressor;
     NonnullOwnPtr<AllocatingMemoryStream> m_output_stream;
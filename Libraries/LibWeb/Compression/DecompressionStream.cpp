@@ -11,12 +11,16 @@
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/TypedArray.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/DecompressionStreamPrototype.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Compression/DecompressionStream.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Streams/TransformStream.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Compression {
 
@@ -52,28 +56,12 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct
     // 3. Let transformAlgorithm be an algorithm which takes a chunk argument and runs the decompress and enqueue a chunk
     //    algorithm with this and chunk.
     auto transform_algorithm = GC::create_function(realm.heap(), [stream](JS::Value chunk) -> GC::Ref<WebIDL::Promise> {
-        auto& realm = stream->realm();
-        auto& vm = realm.vm();
-
-        if (auto result = stream->decompress_and_enqueue_chunk(chunk); result.is_error()) {
-            auto throw_completion = Bindings::exception_to_throw_completion(vm, result.exception());
-            return WebIDL::create_rejected_promise(realm, throw_completion.release_value());
-        }
-
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return stream->decompress_and_enqueue_chunk(chunk);
     });
 
     // 4. Let flushAlgorithm be an algorithm which takes no argument and runs the decompress flush and enqueue algorithm with this.
     auto flush_algorithm = GC::create_function(realm.heap(), [stream]() -> GC::Ref<WebIDL::Promise> {
-        auto& realm = stream->realm();
-        auto& vm = realm.vm();
-
-        if (auto result = stream->decompress_flush_and_enqueue(); result.is_error()) {
-            auto throw_completion = Bindings::exception_to_throw_completion(vm, result.exception());
-            return WebIDL::create_rejected_promise(realm, throw_completion.release_value());
-        }
-
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return stream->decompress_flush_and_enqueue();
     });
 
     // 6. Set up this's transform with transformAlgorithm set to transformAlgorithm and flushAlgorithm set to flushAlgorithm.
@@ -105,73 +93,118 @@ void DecompressionStream::visit_edges(JS::Cell::Visitor& visitor)
 }
 
 // https://compression.spec.whatwg.org/#decompress-and-enqueue-a-chunk
-WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::Value chunk)
+GC::Ref<WebIDL::Promise> DecompressionStream::decompress_and_enqueue_chunk(JS::Value chunk)
 {
     auto& realm = this->realm();
 
     // 1. If chunk is not a BufferSource type, then throw a TypeError.
     if (!WebIDL::is_buffer_source_type(chunk))
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"sv };
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"sv });
+
+    auto chunk_buffer = WebIDL::get_buffer_source_copy(chunk.as_object());
+    if (chunk_buffer.is_error())
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", chunk_buffer.error())) });
 
     // 2. Let buffer be the result of decompressing chunk with ds's format and context. If this results in an error,
     //    then throw a TypeError.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
-        TRY(m_input_stream->write_until_depleted(move(chunk_buffer)));
-
-        auto decompressed = TRY(ByteBuffer::create_uninitialized(4096));
-        auto size = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<size_t> {
-            return TRY(decompressor->read_some(decompressed.bytes())).size();
-        }));
-        return decompressed.slice(0, size);
-    }();
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", maybe_buffer.error())) };
-
-    auto buffer = maybe_buffer.release_value();
-
     // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
     // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
     // 5. For each Uint8Array array, enqueue array in ds's transform.
-    m_transform->enqueue(array);
-    return {};
+    return decompress_and_enqueue_in_parallel(chunk_buffer.release_value(), Finish::No);
 }
 
 // https://compression.spec.whatwg.org/#decompress-flush-and-enqueue
-WebIDL::ExceptionOr<void> DecompressionStream::decompress_flush_and_enqueue()
+GC::Ref<WebIDL::Promise> DecompressionStream::decompress_flush_and_enqueue()
+{
+    // 1. Let buffer be the result of decompressing an empty input with ds's format and context, with the finish flag.
+    // 2. If the end of the compressed input has not been reached, then throw a TypeError.
+    // 3. If buffer is empty, return.
+    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+    // 5. For each Uint8Array array, enqueue array in ds's transform.
+    return decompress_and_enqueue_in_parallel({}, Finish::Yes);
+}
+
+// Like CompressionStream, we decompress on a background thread and only come back to the event loop to enqueue the
+// result. The transform stream waits for the returned promise before handing us the next chunk (or flush).
+GC::Ref<WebIDL::Promise> DecompressionStream::decompress_and_enqueue_in_parallel(ByteBuffer bytes, Finish finish)
 {
     auto& realm = this->realm();
+    auto promise = WebIDL::create_promise(realm);
 
-    // 1. Let buffer be the result of decompressing an empty input with ds's format and context, with the finish flag.
-    auto maybe_buffer = m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
-        return TRY(decompressor->read_until_eof());
-    });
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress flush: {}", maybe_buffer.error())) };
+    auto stream = GC::make_root(*this);
+    auto promise_root = GC::make_root(promise);
+
+    auto settle_promise = [stream, promise_root, finish](ErrorOr<ByteBuffer> buffer) {
+        auto& realm = stream->realm();
 
-    auto buffer = maybe_buffer.release_value();
+        // NB: The Compression spec does not define a task source, so we use the DOM manipulation task source.
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, stream = GC::Ref { *stream }, promise = GC::Ref { *promise_root }, finish, buffer = move(buffer)]() mutable {
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
 
-    // Note: LibCompress already throws an error if we call read_until_eof and no more progress can be made
-    // 2. If the end of the compressed input has not been reached, then throw a TypeError.
-    VERIFY(m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); }));
+            if (buffer.is_error()) {
+                auto message = MUST(String::formatted("Unable to decompress {}: {}", finish == Finish::Yes ? "flush"sv : "chunk"sv, buffer.error()));
+                WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, move(message) }).release_value());
+                return;
+            }
 
-    // 3. If buffer is empty, return.
+            stream->enqueue(buffer.release_value());
+            WebIDL::resolve_promise(realm, promise, JS::js_undefined());
+        }));
+    };
+
+    // NB: Only the decompressor is touched off the event loop. The root keeps this stream alive until the work is done.
+    (void)Threading::BackgroundAction<ByteBuffer>::construct(
+        [stream, bytes = move(bytes), finish](auto&) mutable {
+            return stream->decompress(move(bytes), finish);
+        },
+        [settle_promise](ByteBuffer buffer) -> ErrorOr<void> {
+            settle_promise(move(buffer));
+            return {};
+        },
+        [settle_promise](Error error) {
+            settle_promise(move(error));
+        });
+
+    return promise;
+}
+
+ErrorOr<ByteBuffer> DecompressionStream::decompress(ByteBuffer bytes, Finish finish)
+{
+    if (finish == Finish::Yes) {
+        auto buffer = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
+            return TRY(decompressor->read_until_eof());
+        }));
+
+        // NB: LibCompress already throws an error if we call read_until_eof and no more progress can be made. This runs
+        //     on a background thread, so we don't assert that here, but report it like any other decompression error.
+        if (!m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); }))
+            return Error::from_string_literal("End of compressed input was not reached");
+        return buffer;
+    }
+
+    TRY(m_input_stream->write_until_depleted(move(bytes)));
+
+    auto decompressed = TRY(ByteBuffer::create_uninitialized(4096));
+    auto size = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<size_t> {
+        return TRY(decompressor->read_some(decompressed.bytes())).size();
+    }));
+    return decompressed.slice(0, size);
+}
+
+void DecompressionStream::enqueue(ByteBuffer buffer)
+{
+    auto& realm = this->realm();
+
+    // If buffer is empty, return.
     if (buffer.is_empty())
-        return {};
+        return;
 
-    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+    // Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
     auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
     auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
 
-    // 5. For each Uint8Array array, enqueue array in ds's transform.
+    // For each Uint8Array array, enqueue array in ds's transform.
     m_transform->enqueue(array);
-    return {};
 }
 
 }
@@ -41,8 +41,16 @@ private:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
-    WebIDL::ExceptionOr<void> decompress_and_enqueue_chunk(JS::Value);
-    WebIDL::ExceptionOr<void> decompress_flush_and_enqueue();
+    GC::Ref<WebIDL::Promise> decompress_and_enqueue_chunk(JS::Value);
+    GC::Ref<WebIDL::Promise> decompress_flush_and_enqueue();
+
+    enum class Finish {
+        No,
+        Yes,
+    };
+    GC::Ref<WebIDL::Promise> decompress_and_enqueue_in_parallel(ByteBuffer, Finish);
+    ErrorOr<ByteBuffer> decompress(ByteBuffer, Finish);
+    void enqueue(ByteBuffer);
 
     Decompressor m_decompressor;
     NonnullOwnPtr<AllocatingMemoryStream> m_input_stream;
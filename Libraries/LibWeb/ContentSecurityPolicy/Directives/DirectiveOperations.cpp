@@ -15,7 +15,6 @@
 #include <LibWeb/ContentSecurityPolicy/Directives/SourceExpression.h>
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Element.h>
-#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOMURL/DOMURL.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
@@ -841,19 +840,16 @@ enum class NonceableResult {
     // 2. If element is a script element, then for each attribute of element’s attribute list:
     // FIXME: File spec issue to ask if this should include SVGScriptElement.
     if (is<HTML::HTMLScriptElement>(element.ptr())) {
-        for (size_t attribute_index = 0; attribute_index < element->attributes()->length(); ++attribute_index) {
-            auto const* attribute = element->attributes()->item(attribute_index);
-            VERIFY(attribute);
-
+        for (auto const& attribute : element->attribute_list()) {
             // 1. If attribute’s name contains an ASCII case-insensitive match for "<script" or "<style", return
             //    "Not Nonceable".
-            auto attribute_name = attribute->name().to_string();
+            auto attribute_name = attribute.name().to_string();
             if (attribute_name.contains("<script"sv, CaseSensitivity::CaseInsensitive) || attribute_name.contains("<style"sv, CaseSensitivity::CaseInsensitive))
                 return NonceableResult::NotNonceable;
 
             // 2. If attribute’s value contains an ASCII case-insensitive match for "<script" or "<style", return
             //    "Not Nonceable".
-            auto const& attribute_value = attribute->value();
+            auto const& attribute_value = attribute.value();
             if (attribute_value.contains("<script"sv, CaseSensitivity::CaseInsensitive) || attribute_value.contains("<style"sv, CaseSensitivity::CaseInsensitive))
                 return NonceableResult::NotNonceable;
         }
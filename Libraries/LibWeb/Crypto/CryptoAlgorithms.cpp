@@ -3752,6 +3752,18 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> HKDF::import_key(AlgorithmParams const&,
 
 // https://w3c.github.io/webcrypto/#sha-operations-digest
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+{
+    auto operation = TRY(prepare_digest(algorithm, data)).release_value();
+
+    auto result_buffer = operation.steps();
+    if (result_buffer.is_error())
+        return WebIDL::OperationError::create(m_realm, move(operation.error_message));
+
+    return JS::ArrayBuffer::create(m_realm, result_buffer.release_value());
+}
+
+// https://w3c.github.io/webcrypto/#sha-operations-digest
+WebIDL::ExceptionOr<Optional<ParallelOperation>> SHA::prepare_digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
 {
     auto& algorithm_name = algorithm.name;
 
@@ -3774,15 +3786,16 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const&
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", algorithm_name));
     }
 
-    ::Crypto::Hash::Manager hash { hash_kind };
-    hash.update(data);
-
-    auto digest = hash.digest();
-    auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
-    if (result_buffer.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to create result buffer"_utf16);
+    return ParallelOperation {
+        .steps = [hash_kind, data] -> ErrorOr<ByteBuffer> {
+            ::Crypto::Hash::Manager hash { hash_kind };
+            hash.update(data);
 
-    return JS::ArrayBuffer::create(m_realm, result_buffer.release_value());
+            auto digest = hash.digest();
+            return ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+        },
+        .error_message = "Failed to create result buffer"_utf16,
+    };
 }
 
 // https://w3c.github.io/webcrypto/#ecdsa-operations-generate-key
@@ -6878,6 +6891,18 @@ WebIDL::ExceptionOr<JS::Value> HKDF::get_key_length(AlgorithmParams const&)
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations-derive-bits
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
+{
+    auto operation = TRY(prepare_derive_bits(params, key, length_optional)).release_value();
+
+    auto result = operation.steps();
+    if (result.is_error())
+        return WebIDL::OperationError::create(m_realm, move(operation.error_message));
+
+    return JS::ArrayBuffer::create(m_realm, result.release_value());
+}
+
+// https://w3c.github.io/webcrypto/#pbkdf2-operations-derive-bits
+WebIDL::ExceptionOr<Optional<ParallelOperation>> PBKDF2::prepare_derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
 {
     auto& realm = *m_realm;
     auto const& normalized_algorithm = static_cast<PBKDF2Params const&>(params);
@@ -6916,15 +6941,17 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParam
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", hash_algorithm));
     }());
 
-    ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
-    auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+    return ParallelOperation {
+        .steps = [hash_kind, password = move(password), salt = move(salt), iterations, derived_key_length_bytes] -> ErrorOr<ByteBuffer> {
+            ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
 
-    // 5. If the key derivation operation fails, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create(realm, "Failed to derive key"_utf16);
+            // 6. Return result
+            return pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+        },
 
-    // 6. Return result
-    return JS::ArrayBuffer::create(realm, maybe_result.release_value());
+        // 5. If the key derivation operation fails, then throw an OperationError.
+        .error_message = "Failed to derive key"_utf16,
+    };
 }
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations-get-key-length
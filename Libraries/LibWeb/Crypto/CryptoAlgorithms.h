@@ -9,7 +9,9 @@
 #pragma once
 
 #include <AK/EnumBits.h>
+#include <AK/Function.h>
 #include <AK/String.h>
+#include <AK/Utf16String.h>
 #include <LibCrypto/BigInt/UnsignedBigInteger.h>
 #include <LibGC/Ptr.h>
 #include <LibJS/Forward.h>
@@ -313,6 +315,16 @@ struct HmacKeyGenParams : public AlgorithmParams {
     static JS::ThrowCompletionOr<NonnullOwnPtr<AlgorithmParams>> from_value(JS::VM&, JS::Value);
 };
 
+// The part of an operation that only works on copied bytes, and that can therefore be performed on a background thread
+// instead of blocking the event loop.
+struct ParallelOperation {
+    // These steps must not touch any GC-allocated object.
+    Function<ErrorOr<ByteBuffer>()> steps;
+
+    // The message of the OperationError that is thrown if the steps fail.
+    Utf16String error_message;
+};
+
 class AlgorithmMethods {
 public:
     virtual ~AlgorithmMethods();
@@ -347,6 +359,19 @@ public:
         return WebIDL::NotSupportedError::create(m_realm, "deriveBits is not supported"_utf16);
     }
 
+    // Algorithms whose digest or derive bits operation is expensive can override these to validate their parameters on the
+    // event loop and return the remaining work as a ParallelOperation. Returning nothing means that the operation is
+    // performed through digest() or derive_bits() instead.
+    virtual WebIDL::ExceptionOr<Optional<ParallelOperation>> prepare_digest(AlgorithmParams const&, ByteBuffer const&)
+    {
+        return OptionalNone {};
+    }
+
+    virtual WebIDL::ExceptionOr<Optional<ParallelOperation>> prepare_derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>)
+    {
+        return OptionalNone {};
+    }
+
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&)
     {
         return WebIDL::NotSupportedError::create(m_realm, "importKey is not supported"_utf16);
@@ -546,6 +571,7 @@ class PBKDF2 : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
+    virtual WebIDL::ExceptionOr<Optional<ParallelOperation>> prepare_derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
     virtual WebIDL::ExceptionOr<JS::Value> get_key_length(AlgorithmParams const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new PBKDF2(realm)); }
@@ -560,6 +586,7 @@ private:
 class SHA : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<Optional<ParallelOperation>> prepare_digest(AlgorithmParams const&, ByteBuffer const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new SHA(realm)); }
 
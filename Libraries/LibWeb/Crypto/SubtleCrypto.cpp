@@ -12,6 +12,7 @@
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SubtleCryptoPrototype.h>
@@ -30,6 +31,35 @@ static void normalize_key_usages(Vector<Bindings::KeyUsage>& key_usages)
 {
     quick_sort(key_usages);
 }
+
+using ParallelOperationCallback = GC::Function<void(WebIDL::ExceptionOr<ByteBuffer>)>;
+
+// Performs the steps of the given operation on a background thread, and then queues a global task on the crypto task
+// source to hand their result back to the event loop. Only the steps run off-thread; they work on their own copy of
+// the bytes, while everything touching the JS heap (including settling the promise) happens in on_complete.
+static void perform_operation_in_parallel(JS::Realm& realm, ParallelOperation operation, GC::Ref<ParallelOperationCallback> on_complete)
+{
+    (void)Threading::BackgroundAction<Optional<ByteBuffer>>::construct(
+        [steps = move(operation.steps)](auto&) -> ErrorOr<Optional<ByteBuffer>> {
+            auto result = steps();
+            if (result.is_error())
+                return Optional<ByteBuffer> {};
+            return result.release_value();
+        },
+        [realm = GC::make_root(realm), on_complete = GC::make_root(on_complete), error_message = move(operation.error_message)](Optional<ByteBuffer> result) mutable -> ErrorOr<void> {
+            HTML::queue_global_task(HTML::Task::Source::Crypto, realm->global_object(), GC::create_function(realm->heap(), [realm = GC::Ref { *realm }, on_complete = GC::Ref { *on_complete }, error_message = move(error_message), result = move(result)]() mutable {
+                HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+                if (!result.has_value()) {
+                    on_complete->function()(WebIDL::OperationError::create(realm, move(error_message)));
+                    return;
+                }
+
+                on_complete->function()(result.release_value());
+            }));
+            return {};
+        });
+}
 struct RegisteredAlgorithm {
     NonnullOwnPtr<AlgorithmMethods> (*create_methods)(JS::Realm&) = nullptr;
     JS::ThrowCompletionOr<NonnullOwnPtr<AlgorithmParams>> (*parameter_from_value)(JS::VM&, JS::Value) = nullptr;
@@ -281,6 +311,26 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
         // FIXME: Need spec reference to https://webidl.spec.whatwg.org/#reject
 
         // 8. Let result be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
+        auto parallel_operation = algorithm_object.methods->prepare_digest(*algorithm_object.parameter, data_buffer);
+        if (parallel_operation.is_exception()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), parallel_operation.release_error()).release_value());
+            return;
+        }
+
+        // NB: Hashing large inputs can take a while, so do it on a background thread if the algorithm allows.
+        if (auto operation = parallel_operation.release_value(); operation.has_value()) {
+            perform_operation_in_parallel(realm, operation.release_value(), GC::create_function(realm.heap(), [&realm, promise](WebIDL::ExceptionOr<ByteBuffer> result) {
+                if (result.is_exception()) {
+                    WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
+                    return;
+                }
+
+                // 9. Resolve promise with result.
+                WebIDL::resolve_promise(realm, promise, JS::ArrayBuffer::create(realm, result.release_value()));
+            }));
+            return;
+        }
+
         auto result = algorithm_object.methods->digest(*algorithm_object.parameter, data_buffer);
 
         if (result.is_exception()) {
@@ -638,6 +688,26 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_bits(AlgorithmIdentifier algorithm
         }
 
         // 9. Let result be the result of creating an ArrayBuffer containing the result of performing the derive bits operation specified by normalizedAlgorithm using baseKey, algorithm and length.
+        auto parallel_operation = normalized_algorithm.methods->prepare_derive_bits(*normalized_algorithm.parameter, base_key, length_optional);
+        if (parallel_operation.is_exception()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), parallel_operation.release_error()).release_value());
+            return;
+        }
+
+        // NB: Key derivation functions such as PBKDF2 are slow by design, so run them on a background thread if the algorithm allows.
+        if (auto operation = parallel_operation.release_value(); operation.has_value()) {
+            perform_operation_in_parallel(realm, operation.release_value(), GC::create_function(realm.heap(), [&realm, promise](WebIDL::ExceptionOr<ByteBuffer> result) {
+                if (result.is_exception()) {
+                    WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
+                    return;
+                }
+
+                // 10. Resolve promise with result.
+                WebIDL::resolve_promise(realm, promise, JS::ArrayBuffer::create(realm, result.release_value()));
+            }));
+            return;
+        }
+
         auto result = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length_optional);
         if (result.is_error()) {
             WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
@@ -718,36 +788,59 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_key(AlgorithmIdentifier algorithm,
             length = maybe_length.value();
         }
 
+        auto import_secret = [&realm, promise, normalized_derived_key_algorithm_import = move(normalized_derived_key_algorithm_import), extractable, key_usages = move(key_usages)](ByteBuffer const& secret) mutable {
+            // 15. Let result be the result of performing the import key operation specified by normalizedDerivedKeyAlgorithmImport using "raw" as format, secret as keyData, derivedKeyType as algorithm and using extractable and usages.
+            auto result_or_error = normalized_derived_key_algorithm_import.methods->import_key(*normalized_derived_key_algorithm_import.parameter, Bindings::KeyFormat::Raw, secret, extractable, key_usages);
+            if (result_or_error.is_error()) {
+                WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result_or_error.release_error()).release_value());
+                return;
+            }
+            auto result = result_or_error.release_value();
+
+            // 16. If the [[type]] internal slot of result is "secret" or "private" and usages is empty, then throw a SyntaxError.
+            if ((result->type() == Bindings::KeyType::Secret || result->type() == Bindings::KeyType::Private) && key_usages.is_empty()) {
+                WebIDL::reject_promise(realm, promise, WebIDL::SyntaxError::create(realm, "usages must not be empty"_utf16));
+                return;
+            }
+
+            // 17. Set the [[extractable]] internal slot of result to extractable.
+            result->set_extractable(extractable);
+
+            // 18. Set the [[usages]] internal slot of result to the normalized value of usages.
+            normalize_key_usages(key_usages);
+            result->set_usages(key_usages);
+
+            // 19. Resolve promise with result.
+            WebIDL::resolve_promise(realm, promise, result);
+        };
+
         // 14. Let secret be the result of performing the derive bits operation specified by normalizedAlgorithm using key, algorithm and length.
-        auto secret = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length);
-        if (secret.is_error()) {
-            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), secret.release_error()).release_value());
+        auto parallel_operation = normalized_algorithm.methods->prepare_derive_bits(*normalized_algorithm.parameter, base_key, length);
+        if (parallel_operation.is_exception()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), parallel_operation.release_error()).release_value());
             return;
         }
 
-        // 15. Let result be the result of performing the import key operation specified by normalizedDerivedKeyAlgorithmImport using "raw" as format, secret as keyData, derivedKeyType as algorithm and using extractable and usages.
-        auto result_or_error = normalized_derived_key_algorithm_import.methods->import_key(*normalized_derived_key_algorithm_import.parameter, Bindings::KeyFormat::Raw, secret.release_value()->buffer(), extractable, key_usages);
-        if (result_or_error.is_error()) {
-            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result_or_error.release_error()).release_value());
+        // NB: As in deriveBits(), run the key derivation function on a background thread if the algorithm allows.
+        if (auto operation = parallel_operation.release_value(); operation.has_value()) {
+            perform_operation_in_parallel(realm, operation.release_value(), GC::create_function(realm.heap(), [&realm, promise, import_secret = move(import_secret)](WebIDL::ExceptionOr<ByteBuffer> secret) mutable {
+                if (secret.is_exception()) {
+                    WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), secret.release_error()).release_value());
+                    return;
+                }
+
+                import_secret(secret.value());
+            }));
             return;
         }
-        auto result = result_or_error.release_value();
 
-        // 16. If the [[type]] internal slot of result is "secret" or "private" and usages is empty, then throw a SyntaxError.
-        if ((result->type() == Bindings::KeyType::Secret || result->type() == Bindings::KeyType::Private) && key_usages.is_empty()) {
-            WebIDL::reject_promise(realm, promise, WebIDL::SyntaxError::create(realm, "usages must not be empty"_utf16));
+        auto secret = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length);
+        if (secret.is_error()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), secret.release_error()).release_value());
             return;
         }
 
-        // 17. Set the [[extractable]] internal slot of result to extractable.
-        result->set_extractable(extractable);
-
-        // 18. Set the [[usages]] internal slot of result to the normalized value of usages.
-        normalize_key_usages(key_usages);
-        result->set_usages(key_usages);
-
-        // 19. Resolve promise with result.
-        WebIDL::resolve_promise(realm, promise, result);
+        import_secret(secret.value()->buffer());
     }));
 
     return promise;
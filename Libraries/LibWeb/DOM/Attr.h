@@ -27,6 +27,7 @@ public:
 
     virtual FlyString node_name() const override { return name(); }
 
+    QualifiedName const& qualified_name() const { return m_qualified_name; }
     Optional<FlyString> const& namespace_uri() const { return m_qualified_name.namespace_(); }
     Optional<FlyString> const& prefix() const { return m_qualified_name.prefix(); }
     FlyString const& local_name() const { return m_qualified_name.local_name(); }
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/AttributeList.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/MutationType.h>
+#include <LibWeb/HTML/CustomElements/CustomElementReactionNames.h>
+#include <LibWeb/Namespace.h>
+#include <LibWeb/TrustedTypes/TrustedTypePolicy.h>
+
+namespace Web::DOM {
+
+AttributeList::AttributeList(Element& element)
+    : m_element(element)
+{
+}
+
+AttributeList::~AttributeList() = default;
+
+void AttributeList::visit_edges(JS::Cell::Visitor& visitor)
+{
+    for (auto const& entry : m_entries)
+        visitor.visit(entry.m_node);
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-get-by-name
+Optional<size_t> AttributeList::find_by_name(FlyString const& qualified_name) const
+{
+    // 1. If element is in the HTML namespace and its node document is an HTML document, then set qualifiedName to qualifiedName in ASCII lowercase.
+    FlyString const* effective_qualified_name = &qualified_name;
+    FlyString lowercase_qualified_name;
+    if (m_element.namespace_uri() == Namespace::HTML && m_element.document().is_html_document()) {
+        lowercase_qualified_name = qualified_name.to_ascii_lowercase();
+        effective_qualified_name = &lowercase_qualified_name;
+    }
+
+    // 2. Return the first attribute in element’s attribute list whose qualified name is qualifiedName; otherwise null.
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].name() == *effective_qualified_name)
+            return i;
+    }
+
+    return {};
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-get-by-namespace
+Optional<size_t> AttributeList::find_by_namespace(Optional<FlyString> const& namespace_, FlyString const& local_name) const
+{
+    // 1. If namespace is the empty string, then set it to null.
+    Optional<FlyString> normalized_namespace;
+    if (namespace_ != String {})
+        normalized_namespace = namespace_;
+
+    // 2. Return the attribute in element’s attribute list whose namespace is namespace and local name is localName, if any; otherwise null.
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].namespace_uri() == normalized_namespace && m_entries[i].local_name() == local_name)
+            return i;
+    }
+
+    return {};
+}
+
+Optional<size_t> AttributeList::find_node(Attr const& attribute) const
+{
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].m_node == &attribute)
+            return i;
+    }
+    return {};
+}
+
+GC::Ref<Attr> AttributeList::node_at(size_t index) const
+{
+    auto& entry = m_entries[index];
+    if (!entry.m_node)
+        entry.m_node = Attr::create(m_element.document(), entry.m_qualified_name, move(entry.m_value), &m_element);
+    return *entry.m_node;
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-set
+WebIDL::ExceptionOr<GC::Ptr<Attr>> AttributeList::set(Attr& attribute)
+{
+    // 1. Let verifiedValue be the result of calling get Trusted Types-compliant attribute value
+    //    with attr’s local name, attr’s namespace, element, and attr’s value
+    auto const verified_value = TRY(TrustedTypes::get_trusted_types_compliant_attribute_value(
+        attribute.local_name(),
+        attribute.namespace_uri().has_value() ? Utf16String::from_utf8(attribute.namespace_uri().value()) : Optional<Utf16String>(),
+        m_element,
+        Utf16String::from_utf8(attribute.value())));
+
+    // 2. If attr’s element is neither null nor element, throw an "InUseAttributeError" DOMException.
+    if ((attribute.owner_element() != nullptr) && (attribute.owner_element() != &m_element))
+        return WebIDL::InUseAttributeError::create(m_element.realm(), "Attribute must not already be in use"_utf16);
+
+    // 3. Let oldAttr be the result of getting an attribute given attr’s namespace, attr’s local name, and element.
+    auto old_attribute_index = find_by_namespace(attribute.namespace_uri(), attribute.local_name());
+    GC::Ptr<Attr> old_attribute;
+    if (old_attribute_index.has_value())
+        old_attribute = node_at(*old_attribute_index);
+
+    // 4. If oldAttr is attr, return attr.
+    if (old_attribute == &attribute)
+        return &attribute;
+
+    // 5. Set attr’s value to verifiedValue.
+    TRY(attribute.set_value(verified_value.to_utf8_but_should_be_ported_to_utf16()));
+
+    // 6. If oldAttr is non-null, then replace oldAttr with attr.
+    if (old_attribute) {
+        replace(*old_attribute_index, attribute);
+    }
+    // 7. Otherwise, append attr to element.
+    else {
+        append(attribute);
+    }
+
+    // 8. Return oldAttr.
+    return old_attribute;
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-append
+void AttributeList::append(QualifiedName name, String value)
+{
+    // 1. Append attribute to element’s attribute list.
+    // 2. Set attribute’s element to element.
+    // 3. Set attribute’s node document to element’s node document.
+    // NB: There is no Attr node for the attribute yet; it is created with the right element and node document if it is
+    //     ever needed.
+    m_entries.empend(name, value);
+
+    // 4. Handle attribute changes for attribute with element, null, and attribute’s value.
+    handle_attribute_changes(m_element, name, {}, value);
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-append
+void AttributeList::append(Attr& attribute)
+{
+    // 1. Append attribute to element’s attribute list.
+    Entry entry { attribute.qualified_name(), {} };
+    entry.m_node = attribute;
+    m_entries.append(move(entry));
+
+    // 2. Set attribute’s element to element.
+    attribute.set_owner_element(&m_element);
+
+    // 3. Set attribute’s node document to element’s node document.
+    attribute.set_document(Badge<AttributeList> {}, m_element.document());
+
+    // 4. Handle attribute changes for attribute with element, null, and attribute’s value.
+    handle_attribute_changes(m_element, attribute.qualified_name(), {}, attribute.value());
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-change
+void AttributeList::change(size_t index, String value)
+{
+    auto& entry = m_entries[index];
+    if (entry.m_node) {
+        entry.m_node->change_attribute(move(value));
+        return;
+    }
+
+    // NB: The attribute change steps may add or remove attributes, so we must not hold on to the entry below.
+    auto name = entry.m_qualified_name;
+
+    // 1. Let oldValue be attribute’s value.
+    auto old_value = move(entry.m_value);
+
+    // 2. Set attribute’s value to value.
+    entry.m_value = value;
+
+    // 3. Handle attribute changes for attribute with attribute’s element, oldValue, and value.
+    handle_attribute_changes(m_element, name, old_value, value);
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-replace
+void AttributeList::replace(size_t index, Attr& new_attribute)
+{
+    // 1. Let element be oldAttribute’s element.
+    // 2. Replace oldAttribute by newAttribute in element’s attribute list.
+    Entry new_entry { new_attribute.qualified_name(), {} };
+    new_entry.m_node = new_attribute;
+    auto old_entry = exchange(m_entries[index], move(new_entry));
+
+    // 3. Set newAttribute’s element to element.
+    new_attribute.set_owner_element(&m_element);
+
+    // 4. Set newAttribute’s node document to element’s node document.
+    new_attribute.set_document(Badge<AttributeList> {}, m_element.document());
+
+    // 5. Set oldAttribute’s element to null.
+    if (old_entry.m_node)
+        old_entry.m_node->set_owner_element(nullptr);
+
+    // 6. Handle attribute changes for oldAttribute with element, oldAttribute’s value, and newAttribute’s value.
+    handle_attribute_changes(m_element, old_entry.qualified_name(), old_entry.value(), new_attribute.value());
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-remove
+void AttributeList::remove(size_t index)
+{
+    // 1. Let element be attribute’s element.
+    // 2. Remove attribute from element’s attribute list.
+    auto entry = m_entries.take(index);
+
+    // 3. Set attribute’s element to null.
+    if (entry.m_node)
+        entry.m_node->set_owner_element(nullptr);
+
+    // 4. Handle attribute changes for attribute with element, attribute’s value, and null.
+    handle_attribute_changes(m_element, entry.qualified_name(), entry.value(), {});
+}
+
+// https://dom.spec.whatwg.org/#handle-attribute-changes
+void AttributeList::handle_attribute_changes(Element& element, QualifiedName const& name, Optional<String> const& old_value, Optional<String> const& new_value)
+{
+    // 1. Queue a mutation record of "attributes" for element with attribute’s local name, attribute’s namespace, oldValue, « », « », null, and null.
+    element.queue_mutation_record(MutationType::attributes, name.local_name(), name.namespace_(), old_value, {}, {}, nullptr, nullptr);
+
+    // 2. If element is custom, then enqueue a custom element callback reaction with element, callback name "attributeChangedCallback",
+    //    and « attribute’s local name, oldValue, newValue, attribute’s namespace ».
+    if (element.is_custom()) {
+        auto& vm = element.vm();
+
+        GC::RootVector<JS::Value> arguments { vm.heap() };
+        arguments.append(JS::PrimitiveString::create(vm, name.local_name()));
+        arguments.append(!old_value.has_value() ? JS::js_null() : JS::PrimitiveString::create(vm, old_value.value()));
+        arguments.append(!new_value.has_value() ? JS::js_null() : JS::PrimitiveString::create(vm, new_value.value()));
+        arguments.append(!name.namespace_().has_value() ? JS::js_null() : JS::PrimitiveString::create(vm, name.namespace_().value()));
+
+        element.enqueue_a_custom_element_callback_reaction(HTML::CustomElementReactionNames::attributeChangedCallback, move(arguments));
+    }
+
+    // 3. Run the attribute change steps with element, attribute’s local name, oldValue, newValue, and attribute’s namespace.
+    element.run_attribute_change_steps(name.local_name(), old_value, new_value, name.namespace_());
+}
+
+}
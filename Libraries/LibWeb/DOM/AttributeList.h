@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibWeb/DOM/Attr.h>
+#include <LibWeb/DOM/QualifiedName.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::DOM {
+
+// https://dom.spec.whatwg.org/#concept-element-attribute
+// An element's attribute list. Attributes are stored as plain (name, value) pairs, and the Attr node for an attribute
+// is only created once something asks for it, e.g. through element.attributes or getAttributeNode(). Most attributes
+// are never accessed as nodes, so this saves a GC cell per attribute.
+class WEB_API AttributeList {
+    AK_MAKE_NONCOPYABLE(AttributeList);
+    AK_MAKE_NONMOVABLE(AttributeList);
+
+public:
+    class Entry {
+    public:
+        Entry(QualifiedName name, String value)
+            : m_qualified_name(move(name))
+            , m_value(move(value))
+        {
+        }
+
+        QualifiedName const& qualified_name() const { return m_qualified_name; }
+        Optional<FlyString> const& namespace_uri() const { return m_qualified_name.namespace_(); }
+        Optional<FlyString> const& prefix() const { return m_qualified_name.prefix(); }
+        FlyString const& local_name() const { return m_qualified_name.local_name(); }
+        FlyString const& name() const { return m_qualified_name.as_string(); }
+
+        // Once the Attr node has been created, it owns the attribute's value.
+        String const& value() const { return m_node ? m_node->value() : m_value; }
+
+        GC::Ptr<Attr> node() const { return m_node; }
+
+    private:
+        friend class AttributeList;
+
+        QualifiedName m_qualified_name;
+        String m_value;
+        GC::Ptr<Attr> m_node;
+    };
+
+    explicit AttributeList(Element&);
+    ~AttributeList();
+
+    size_t size() const { return m_entries.size(); }
+    bool is_empty() const { return m_entries.is_empty(); }
+
+    Entry const& at(size_t index) const { return m_entries[index]; }
+
+    auto begin() const { return m_entries.begin(); }
+    auto end() const { return m_entries.end(); }
+
+    Optional<size_t> find_by_name(FlyString const& qualified_name) const;
+    Optional<size_t> find_by_namespace(Optional<FlyString> const& namespace_, FlyString const& local_name) const;
+    Optional<size_t> find_node(Attr const&) const;
+
+    // Returns the Attr node for the attribute at the given index, creating it if needed.
+    GC::Ref<Attr> node_at(size_t index) const;
+
+    WebIDL::ExceptionOr<GC::Ptr<Attr>> set(Attr&);
+    void append(QualifiedName, String value);
+    void append(Attr&);
+    void change(size_t index, String value);
+    void replace(size_t index, Attr& new_attribute);
+    void remove(size_t index);
+
+    void visit_edges(JS::Cell::Visitor&);
+
+    static void handle_attribute_changes(Element&, QualifiedName const&, Optional<String> const& old_value, Optional<String> const& new_value);
+
+private:
+    Element& m_element;
+    mutable Vector<Entry> m_entries;
+};
+
+}
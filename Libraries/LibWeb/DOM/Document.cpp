@@ -9,6 +9,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/Bitmap.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
@@ -36,6 +37,7 @@
 #include <LibWeb/Animations/AnimationPlaybackEvent.h>
 #include <LibWeb/Animations/AnimationTimeline.h>
 #include <LibWeb/Animations/DocumentTimeline.h>
+#include <LibWeb/Animations/KeyframeEffect.h>
 #include <LibWeb/Animations/TimeValue.h>
 #include <LibWeb/Bindings/DocumentPrototype.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -176,6 +178,7 @@
 #include <LibWeb/Page/EventHandler.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/AccumulatedVisualContext.h>
+#include <LibWeb/Painting/CompositorAnimation.h>
 #include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/DisplayListCommand.h>
 #include <LibWeb/Painting/PaintableBox.h>
@@ -634,6 +637,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_shared_resource_requests);
 
     visitor.visit(m_associated_animation_timelines);
+    visitor.visit(m_compositor_animation_effects);
     visitor.visit(m_list_of_available_images);
 
     for (auto* form_associated_element : m_form_associated_elements_with_form_attribute)
@@ -6640,6 +6644,18 @@ void Document::set_needs_to_refresh_scroll_state(bool b)
         paintable->set_needs_to_refresh_scroll_state(b);
 }
 
+void Document::set_has_non_passive_wheel_event_listeners()
+{
+    if (m_has_non_passive_wheel_event_listeners)
+        return;
+    m_has_non_passive_wheel_event_listeners = true;
+
+    // NB: The listener may cancel wheel events, so they must not be scrolled asynchronously any longer. Otherwise,
+    //     this would only take effect once the next display list is recorded.
+    if (auto navigable = this->navigable())
+        navigable->invalidate_asynchronous_scroll_state();
+}
+
 Vector<GC::Root<Range>> Document::find_matching_text(String const& query, CaseSensitivity case_sensitivity)
 {
     // Ensure the layout tree exists before searching for text matches.
@@ -6922,8 +6938,15 @@ RefPtr<Painting::DisplayList> Document::cached_display_list() const
 
 RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig config)
 {
-    if (m_cached_display_list && m_cached_display_list_paint_config == config)
-        return m_cached_display_list;
+    if (m_cached_display_list && m_cached_display_list_paint_config == config) {
+        // NB: Pausing, seeking or otherwise changing an animation doesn't necessarily change its current value, and so
+        //     might not have invalidated the display list. The rendering thread must not keep advancing such animations.
+        auto compositor_animations_are_current = all_of(m_compositor_animation_effects, [&](auto const& effect) {
+            return effect->compositor_animation_state_is_current(m_display_list_generation);
+        });
+        if (compositor_animations_are_current)
+            return m_cached_display_list;
+    }
 
     auto display_list = Painting::DisplayList::create(page().client().device_pixels_per_css_pixel());
     Painting::DisplayListRecorder display_list_recorder(display_list);
@@ -6982,10 +7005,21 @@ RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig co
 
     m_cached_display_list = display_list;
     m_cached_display_list_paint_config = config;
+    ++m_display_list_generation;
+    m_compositor_animations.clear();
+    m_compositor_animation_effects.clear();
 
     return display_list;
 }
 
+Vector<NonnullRefPtr<Painting::CompositorAnimation const>> const& Document::compositor_animations()
+{
+    VERIFY(m_cached_display_list);
+    if (!m_compositor_animations.has_value())
+        m_compositor_animations = Painting::CompositorAnimation::collect(*paintable(), m_display_list_generation, m_compositor_animation_effects);
+    return *m_compositor_animations;
+}
+
 Unicode::Segmenter& Document::grapheme_segmenter() const
 {
     if (!m_grapheme_segmenter)
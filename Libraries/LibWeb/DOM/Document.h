@@ -615,6 +615,9 @@ public:
 
     void set_needs_to_refresh_scroll_state(bool b);
 
+    bool has_non_passive_wheel_event_listeners() const { return m_has_non_passive_wheel_event_listeners; }
+    void set_has_non_passive_wheel_event_listeners();
+
     bool has_active_favicon() const { return m_active_favicon; }
     void check_favicon_after_loading_link_resource();
 
@@ -886,6 +889,12 @@ public:
     RefPtr<Painting::DisplayList> cached_display_list() const;
     RefPtr<Painting::DisplayList> record_display_list(HTML::PaintConfig);
 
+    // Incremented every time a new display list is recorded.
+    u64 display_list_generation() const { return m_display_list_generation; }
+
+    // The animations of the cached display list that the rendering thread can run by itself.
+    Vector<NonnullRefPtr<Painting::CompositorAnimation const>> const& compositor_animations();
+
     void invalidate_display_list();
 
     Unicode::Segmenter& grapheme_segmenter() const;
@@ -1346,6 +1355,13 @@ private:
 
     Optional<HTML::PaintConfig> m_cached_display_list_paint_config;
     RefPtr<Painting::DisplayList> m_cached_display_list;
+    u64 m_display_list_generation { 0 };
+
+    Optional<Vector<NonnullRefPtr<Painting::CompositorAnimation const>>> m_compositor_animations;
+    Vector<GC::Ref<Animations::KeyframeEffect>> m_compositor_animation_effects;
+
+    // NB: This is never reset, as we don't keep track of when the last such listener is removed.
+    bool m_has_non_passive_wheel_event_listeners { false };
 
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_line_segmenter;
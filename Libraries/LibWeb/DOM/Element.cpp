@@ -117,6 +117,7 @@ GC_DEFINE_ALLOCATOR(Element);
 Element::Element(Document& document, DOM::QualifiedName qualified_name)
     : ParentNode(document, NodeType::ELEMENT_NODE)
     , m_qualified_name(move(qualified_name))
+    , m_attribute_list(*this)
 {
 }
 
@@ -135,6 +136,7 @@ void Element::visit_edges(Cell::Visitor& visitor)
     Animatable::visit_edges(visitor);
     ARIAMixin::visit_edges(visitor);
 
+    m_attribute_list.visit_edges(visitor);
     visitor.visit(m_attributes);
     visitor.visit(m_inline_style);
     visitor.visit(m_class_list);
@@ -163,48 +165,42 @@ void Element::visit_edges(Cell::Visitor& visitor)
 Optional<String> Element::get_attribute(FlyString const& name) const
 {
     // 1. Let attr be the result of getting an attribute given qualifiedName and this.
-    if (!m_attributes)
-        return {};
-    auto const* attribute = m_attributes->get_attribute(name);
+    auto index = m_attribute_list.find_by_name(name);
 
     // 2. If attr is null, return null.
-    if (!attribute)
+    if (!index.has_value())
         return {};
 
     // 3. Return attr’s value.
-    return attribute->value();
+    return m_attribute_list.at(*index).value();
 }
 
 // https://dom.spec.whatwg.org/#dom-element-getattributens
 Optional<String> Element::get_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& name) const
 {
     // 1. Let attr be the result of getting an attribute given namespace, localName, and this.
-    if (!m_attributes)
-        return {};
-    auto const* attribute = m_attributes->get_attribute_ns(namespace_, name);
+    auto index = m_attribute_list.find_by_namespace(namespace_, name);
 
     // 2. If attr is null, return null.
-    if (!attribute)
+    if (!index.has_value())
         return {};
 
     // 3. Return attr’s value.
-    return attribute->value();
+    return m_attribute_list.at(*index).value();
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-get-value
 String Element::get_attribute_value(FlyString const& local_name, Optional<FlyString> const& namespace_) const
 {
     // 1. Let attr be the result of getting an attribute given namespace, localName, and element.
-    if (!m_attributes)
-        return {};
-    auto const* attribute = m_attributes->get_attribute_ns(namespace_, local_name);
+    auto index = m_attribute_list.find_by_namespace(namespace_, local_name);
 
     // 2. If attr is null, then return the empty string.
-    if (!attribute)
+    if (!index.has_value())
         return String {};
 
     // 3. Return attr’s value.
-    return attribute->value();
+    return m_attribute_list.at(*index).value();
 }
 
 // https://html.spec.whatwg.org/multipage/semantics.html#get-an-element's-target
@@ -334,18 +330,20 @@ void Element::follow_the_hyperlink(Optional<String> hyperlink_suffix, HTML::User
 GC::Ptr<Attr> Element::get_attribute_node(FlyString const& name) const
 {
     // The getAttributeNode(qualifiedName) method steps are to return the result of getting an attribute given qualifiedName and this.
-    if (!m_attributes)
+    auto index = m_attribute_list.find_by_name(name);
+    if (!index.has_value())
         return {};
-    return m_attributes->get_attribute(name);
+    return m_attribute_list.node_at(*index);
 }
 
 // https://dom.spec.whatwg.org/#dom-element-getattributenodens
 GC::Ptr<Attr> Element::get_attribute_node_ns(Optional<FlyString> const& namespace_, FlyString const& name) const
 {
     // The getAttributeNodeNS(namespace, localName) method steps are to return the result of getting an attribute given namespace, localName, and this.
-    if (!m_attributes)
+    auto index = m_attribute_list.find_by_namespace(namespace_, name);
+    if (!index.has_value())
         return {};
-    return m_attributes->get_attribute_ns(namespace_, name);
+    return m_attribute_list.node_at(*index);
 }
 
 // https://dom.spec.whatwg.org/#dom-element-setattribute
@@ -365,20 +363,18 @@ WebIDL::ExceptionOr<void> Element::set_attribute_for_bindings(FlyString qualifie
     auto const verified_value = TRY(TrustedTypes::get_trusted_types_compliant_attribute_value(qualified_name, {}, *this, value));
 
     // 4. Let attribute be the first attribute in this’s attribute list whose qualified name is qualifiedName, and null otherwise.
-    auto* attribute = attributes()->get_attribute(qualified_name);
+    auto index = m_attribute_list.find_by_name(qualified_name);
 
     // 5. If attribute is non-null, then change attribute to verifiedValue and return.
-    if (attribute) {
-        attribute->change_attribute(verified_value.to_utf8_but_should_be_ported_to_utf16());
+    if (index.has_value()) {
+        m_attribute_list.change(*index, verified_value.to_utf8_but_should_be_ported_to_utf16());
         return {};
     }
 
     // 6. Set attribute to a new attribute whose local name is qualifiedName, value is verifiedValue,
     //    and node document is this’s node document.
-    attribute = Attr::create(document(), qualified_name, verified_value.to_utf8_but_should_be_ported_to_utf16());
-
     // 7. Append attribute to this.
-    m_attributes->append_attribute(*attribute);
+    m_attribute_list.append({ qualified_name, {}, {} }, verified_value.to_utf8_but_should_be_ported_to_utf16());
 
     return {};
 }
@@ -525,95 +521,99 @@ WebIDL::ExceptionOr<void> Element::set_attribute_ns_for_bindings(Optional<FlyStr
 // https://dom.spec.whatwg.org/#concept-element-attributes-append
 void Element::append_attribute(FlyString const& name, String const& value)
 {
-    attributes()->append_attribute(Attr::create(document(), name, value));
+    m_attribute_list.append({ name, {}, {} }, value);
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-append
+void Element::append_attribute(QualifiedName name, String const& value)
+{
+    m_attribute_list.append(move(name), value);
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-append
 void Element::append_attribute(Attr& attribute)
 {
-    attributes()->append_attribute(attribute);
+    m_attribute_list.append(attribute);
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-set-value
 void Element::set_attribute_value(FlyString const& local_name, String const& value, Optional<FlyString> const& prefix, Optional<FlyString> const& namespace_)
 {
     // 1. Let attribute be the result of getting an attribute given namespace, localName, and element.
-    auto* attribute = attributes()->get_attribute_ns(namespace_, local_name);
+    auto index = m_attribute_list.find_by_namespace(namespace_, local_name);
 
     // 2. If attribute is null, create an attribute whose namespace is namespace, namespace prefix is prefix, local name
     //    is localName, value is value, and node document is element’s node document, then append this attribute to element,
     //    and then return.
-    if (!attribute) {
-        QualifiedName name { local_name, prefix, namespace_ };
-
-        auto new_attribute = Attr::create(document(), move(name), value);
-        m_attributes->append_attribute(new_attribute);
-
+    if (!index.has_value()) {
+        m_attribute_list.append({ local_name, prefix, namespace_ }, value);
         return;
     }
 
     // 3. Change attribute to value.
-    attribute->change_attribute(value);
+    m_attribute_list.change(*index, value);
 }
 
 // https://dom.spec.whatwg.org/#dom-element-setattributenode
 WebIDL::ExceptionOr<GC::Ptr<Attr>> Element::set_attribute_node_for_bindings(Attr& attr)
 {
     // The setAttributeNode(attr) and setAttributeNodeNS(attr) methods steps are to return the result of setting an attribute given attr and this.
-    return attributes()->set_attribute(attr);
+    return m_attribute_list.set(attr);
 }
 
 // https://dom.spec.whatwg.org/#dom-element-setattributenodens
 WebIDL::ExceptionOr<GC::Ptr<Attr>> Element::set_attribute_node_ns_for_bindings(Attr& attr)
 {
     // The setAttributeNode(attr) and setAttributeNodeNS(attr) methods steps are to return the result of setting an attribute given attr and this.
-    return attributes()->set_attribute(attr);
+    return m_attribute_list.set(attr);
 }
 
 // https://dom.spec.whatwg.org/#dom-element-removeattribute
 void Element::remove_attribute(FlyString const& name)
 {
     // The removeAttribute(qualifiedName) method steps are to remove an attribute given qualifiedName and this, and then return undefined.
-    if (!m_attributes)
-        return;
-    m_attributes->remove_attribute(name);
+    if (auto index = m_attribute_list.find_by_name(name); index.has_value())
+        m_attribute_list.remove(*index);
 }
 
 // https://dom.spec.whatwg.org/#dom-element-removeattributens
 void Element::remove_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& name)
 {
     // The removeAttributeNS(namespace, localName) method steps are to remove an attribute given namespace, localName, and this, and then return undefined.
-    if (!m_attributes)
-        return;
-    m_attributes->remove_attribute_ns(namespace_, name);
+    if (auto index = m_attribute_list.find_by_namespace(namespace_, name); index.has_value())
+        m_attribute_list.remove(*index);
 }
 
 // https://dom.spec.whatwg.org/#dom-element-removeattributenode
 WebIDL::ExceptionOr<GC::Ref<Attr>> Element::remove_attribute_node(GC::Ref<Attr> attr)
 {
-    return attributes()->remove_attribute_node(attr);
+    // 1. If this’s attribute list does not contain attr, then throw a "NotFoundError" DOMException.
+    auto index = m_attribute_list.find_node(attr);
+    if (!index.has_value())
+        return WebIDL::NotFoundError::create(realm(), "Attribute not found"_utf16);
+
+    // 2. Remove attr.
+    m_attribute_list.remove(*index);
+
+    // 3. Return attr.
+    return attr;
 }
 
 // https://dom.spec.whatwg.org/#dom-element-hasattribute
 bool Element::has_attribute(FlyString const& name) const
 {
-    if (!m_attributes)
-        return false;
-    return m_attributes->get_attribute(name) != nullptr;
+    return m_attribute_list.find_by_name(name).has_value();
 }
 
 // https://dom.spec.whatwg.org/#dom-element-hasattributens
 bool Element::has_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& name) const
 {
-    if (!m_attributes)
-        return false;
-
     // 1. If namespace is the empty string, then set it to null.
     // 2. Return true if this has an attribute whose namespace is namespace and local name is localName; otherwise false.
     if (namespace_ == FlyString {})
-        return m_attributes->get_attribute_ns(OptionalNone {}, name) != nullptr;
+        return m_attribute_list.find_by_namespace(OptionalNone {}, name).has_value();
 
-    return m_attributes->get_attribute_ns(namespace_, name) != nullptr;
+    return m_attribute_list.find_by_namespace(namespace_, name).has_value();
 }
 
 // https://dom.spec.whatwg.org/#dom-element-toggleattribute
@@ -627,16 +627,14 @@ WebIDL::ExceptionOr<bool> Element::toggle_attribute(FlyString const& name, Optio
     bool insert_as_lowercase = namespace_uri() == Namespace::HTML && document().document_type() == Document::Type::HTML;
 
     // 3. Let attribute be the first attribute in this’s attribute list whose qualified name is qualifiedName, and null otherwise.
-    auto* attribute = attributes()->get_attribute(name);
+    auto index = m_attribute_list.find_by_name(name);
 
     // 4. If attribute is null, then:
-    if (!attribute) {
+    if (!index.has_value()) {
         // 1. If force is not given or is true, create an attribute whose local name is qualifiedName, value is the empty
         //    string, and node document is this’s node document, then append this attribute to this, and then return true.
         if (!force.has_value() || force.value()) {
-            auto new_attribute = Attr::create(document(), insert_as_lowercase ? name.to_ascii_lowercase() : name.to_string(), String {});
-            m_attributes->append_attribute(new_attribute);
-
+            m_attribute_list.append({ insert_as_lowercase ? name.to_ascii_lowercase() : name, {}, {} }, String {});
             return true;
         }
 
@@ -646,7 +644,7 @@ WebIDL::ExceptionOr<bool> Element::toggle_attribute(FlyString const& name, Optio
 
     // 5. Otherwise, if force is not given or is false, remove an attribute given qualifiedName and this, and then return false.
     if (!force.has_value() || !force.value()) {
-        m_attributes->remove_attribute(name);
+        m_attribute_list.remove(*index);
         return false;
     }
 
@@ -658,13 +656,10 @@ WebIDL::ExceptionOr<bool> Element::toggle_attribute(FlyString const& name, Optio
 Vector<String> Element::get_attribute_names() const
 {
     // The getAttributeNames() method steps are to return the qualified names of the attributes in this’s attribute list, in order; otherwise a new list.
-    if (!m_attributes)
-        return {};
     Vector<String> names;
-    for (size_t i = 0; i < m_attributes->length(); ++i) {
-        auto const* attribute = m_attributes->item(i);
-        names.append(attribute->name().to_string());
-    }
+    names.ensure_capacity(m_attribute_list.size());
+    for (auto const& attribute : m_attribute_list)
+        names.unchecked_append(attribute.name().to_string());
     return names;
 }
 
@@ -3030,17 +3025,15 @@ JS::ThrowCompletionOr<void> Element::upgrade_element(GC::Ref<HTML::CustomElement
 
     // 4. For each attribute in element's attribute list, in order, enqueue a custom element callback reaction with element, callback name "attributeChangedCallback",
     //    and « attribute's local name, null, attribute's value, attribute's namespace ».
-    size_t attribute_count = m_attributes ? m_attributes->length() : 0;
-    for (size_t attribute_index = 0; attribute_index < attribute_count; ++attribute_index) {
-        auto const* attribute = m_attributes->item(attribute_index);
-        VERIFY(attribute);
+    for (size_t attribute_index = 0; attribute_index < m_attribute_list.size(); ++attribute_index) {
+        auto const& attribute = m_attribute_list.at(attribute_index);
 
         GC::RootVector<JS::Value> arguments { vm.heap() };
 
-        arguments.append(JS::PrimitiveString::create(vm, attribute->local_name()));
+        arguments.append(JS::PrimitiveString::create(vm, attribute.local_name()));
         arguments.append(JS::js_null());
-        arguments.append(JS::PrimitiveString::create(vm, attribute->value()));
-        arguments.append(attribute->namespace_uri().has_value() ? JS::PrimitiveString::create(vm, attribute->namespace_uri().value()) : JS::js_null());
+        arguments.append(JS::PrimitiveString::create(vm, attribute.value()));
+        arguments.append(attribute.namespace_uri().has_value() ? JS::PrimitiveString::create(vm, attribute.namespace_uri().value()) : JS::js_null());
 
         enqueue_a_custom_element_callback_reaction(HTML::CustomElementReactionNames::attributeChangedCallback, move(arguments));
     }
@@ -3183,19 +3176,18 @@ Optional<String> Element::locate_a_namespace_prefix(Optional<String> const& name
     return {};
 }
 
-void Element::for_each_attribute(Function<void(Attr const&)> callback) const
+void Element::for_each_attribute(Function<void(AttributeList::Entry const&)> callback) const
 {
-    if (!m_attributes)
-        return;
-    for (size_t i = 0; i < m_attributes->length(); ++i)
-        callback(*m_attributes->item(i));
+    for (size_t i = 0; i < m_attribute_list.size(); ++i)
+        callback(m_attribute_list.at(i));
 }
 
 void Element::for_each_attribute(Function<void(FlyString const&, String const&)> callback) const
 {
-    for_each_attribute([&callback](Attr const& attr) {
-        callback(attr.name(), attr.value());
-    });
+    for (size_t i = 0; i < m_attribute_list.size(); ++i) {
+        auto const& attribute = m_attribute_list.at(i);
+        callback(attribute.name(), attribute.value());
+    }
 }
 
 GC::Ptr<Layout::NodeWithStyle> Element::layout_node()
@@ -3210,12 +3202,12 @@ GC::Ptr<Layout::NodeWithStyle const> Element::layout_node() const
 
 bool Element::has_attributes() const
 {
-    return m_attributes && !m_attributes->is_empty();
+    return !m_attribute_list.is_empty();
 }
 
 size_t Element::attribute_list_size() const
 {
-    return m_attributes ? m_attributes->length() : 0;
+    return m_attribute_list.size();
 }
 
 GC::Ptr<CSS::CascadedProperties> Element::cascaded_properties(Optional<CSS::PseudoElement> pseudo_element) const
@@ -14,6 +14,7 @@
 #include <LibWeb/Bindings/ShadowRootPrototype.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleProperty.h>
+#include <LibWeb/DOM/AttributeList.h>
 #include <LibWeb/DOM/ChildNode.h>
 #include <LibWeb/DOM/NonDocumentTypeChildNode.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -170,6 +171,7 @@ public:
     WebIDL::ExceptionOr<GC::Ptr<Attr>> set_attribute_node_ns_for_bindings(Attr&);
 
     void append_attribute(FlyString const& name, String const& value);
+    void append_attribute(QualifiedName, String const& value);
     void append_attribute(Attr&);
     void remove_attribute(FlyString const& name);
     void remove_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& name);
@@ -181,6 +183,9 @@ public:
     GC::Ptr<NamedNodeMap const> attributes() const;
     GC::Ptr<NamedNodeMap> attributes();
 
+    AttributeList& attribute_list() { return m_attribute_list; }
+    AttributeList const& attribute_list() const { return m_attribute_list; }
+
     Vector<String> get_attribute_names() const;
 
     GC::Ptr<Attr> get_attribute_node(FlyString const& name) const;
@@ -206,7 +211,7 @@ public:
     int client_height() const;
     [[nodiscard]] double current_css_zoom() const;
 
-    void for_each_attribute(Function<void(Attr const&)>) const;
+    void for_each_attribute(Function<void(AttributeList::Entry const&)>) const;
 
     void for_each_attribute(Function<void(FlyString const&, String const&)>) const;
 
@@ -591,6 +596,7 @@ private:
     QualifiedName m_qualified_name;
     mutable Optional<FlyString> m_html_uppercased_qualified_name;
 
+    AttributeList m_attribute_list;
     GC::Ptr<NamedNodeMap> m_attributes;
     GC::Ptr<CSS::CSSStyleProperties> m_inline_style;
     GC::Ptr<CSS::StylePropertyMap> m_attribute_style_map;
@@ -220,6 +220,14 @@ void EventTarget::add_an_event_listener(DOMEventListener& listener)
         listener.passive = default_passive_value(listener.type, this);
     }
 
+    // NB: Wheel events that could be canceled by a listener must not be scrolled without waiting for the main thread.
+    if (!*listener.passive && AK::first_is_one_of(listener.type, "wheel"sv, "mousewheel"sv)) {
+        if (auto* node = as_if<Node>(this))
+            node->document().set_has_non_passive_wheel_event_listeners();
+        else if (auto* window = as_if<HTML::Window>(this))
+            window->associated_document().set_has_non_passive_wheel_event_listeners();
+    }
+
     // 5. If eventTarget’s event listener list does not contain an event listener whose type is listener’s type, callback is listener’s callback,
     //    and capture is listener’s capture, then append listener to eventTarget’s event listener list.
     auto it = event_listener_list.find_if([&](auto& entry) {
@@ -17,6 +17,7 @@
 namespace Web::DOM {
 
 // https://dom.spec.whatwg.org/#interface-namednodemap
+// NB: This is only a view of the associated element's attribute list, created when script asks for element.attributes.
 class WEB_API NamedNodeMap : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(NamedNodeMap, Bindings::PlatformObject);
     GC_DECLARE_ALLOCATOR(NamedNodeMap);
@@ -29,8 +30,8 @@ public:
     virtual Optional<JS::Value> item_value(size_t index) const override;
     virtual JS::Value named_item_value(FlyString const& name) const override;
 
-    size_t length() const { return m_attributes.size(); }
-    bool is_empty() const { return m_attributes.is_empty(); }
+    size_t length() const;
+    bool is_empty() const;
 
     // Methods defined by the spec for JavaScript:
     Attr const* item(u32 index) const;
@@ -41,21 +42,6 @@ public:
     WebIDL::ExceptionOr<Attr const*> remove_named_item(FlyString const& qualified_name);
     WebIDL::ExceptionOr<Attr const*> remove_named_item_ns(Optional<FlyString> const& namespace_, FlyString const& local_name);
 
-    // Methods defined by the spec for internal use:
-    Attr* get_attribute(FlyString const& qualified_name, size_t* item_index = nullptr);
-    Attr const* get_attribute(FlyString const& qualified_name, size_t* item_index = nullptr) const;
-    WebIDL::ExceptionOr<GC::Ptr<Attr>> set_attribute(Attr& attribute);
-    void replace_attribute(Attr& old_attribute, Attr& new_attribute, size_t old_attribute_index);
-    void append_attribute(Attr& attribute);
-
-    Attr* get_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name, size_t* item_index = nullptr);
-    Attr const* get_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name, size_t* item_index = nullptr) const;
-
-    Attr const* remove_attribute(FlyString const& qualified_name);
-    Attr const* remove_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name);
-
-    WebIDL::ExceptionOr<GC::Ref<Attr>> remove_attribute_node(GC::Ref<Attr>);
-
 private:
     explicit NamedNodeMap(Element&);
 
@@ -65,10 +51,10 @@ private:
     Element& associated_element() { return *m_element; }
     Element const& associated_element() const { return *m_element; }
 
-    void remove_attribute_at_index(size_t attribute_index);
+    AttributeList& attribute_list();
+    AttributeList const& attribute_list() const;
 
     GC::Ref<DOM::Element> m_element;
-    Vector<GC::Ref<Attr>> m_attributes;
 };
 
 }
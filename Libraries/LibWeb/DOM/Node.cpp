@@ -33,7 +33,6 @@
 #include <LibWeb/DOM/IDLEventListener.h>
 #include <LibWeb/DOM/LiveNodeList.h>
 #include <LibWeb/DOM/MutationType.h>
-#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/DOM/NodeIterator.h>
 #include <LibWeb/DOM/ProcessingInstruction.h>
@@ -1434,24 +1433,14 @@ WebIDL::ExceptionOr<GC::Ref<Node>> Node::clone_single_node(Document& document) c
         auto element_copy = TRY(DOM::create_element(document, element.local_name(), element.namespace_uri(), element.prefix(), element.is_value()));
 
         // 2. For each attribute of node’s attribute list:
-        Optional<WebIDL::Exception> maybe_exception;
-        element.for_each_attribute([&](Attr const& attr) {
+        element.for_each_attribute([&](AttributeList::Entry const& attribute) {
             // 1. Let copyAttribute be the result of cloning a single node given attribute and document.
-            auto copy_attribute_or_error = attr.clone_single_node(document);
-            if (copy_attribute_or_error.is_error()) {
-                maybe_exception = copy_attribute_or_error.release_error();
-                return;
-            }
-
-            auto copy_attribute = copy_attribute_or_error.release_value();
-
             // 2. Append copyAttribute to copy.
-            element_copy->append_attribute(as<Attr>(*copy_attribute));
+            // NB: Cloning an attribute only copies its name and value, so we append those directly rather than creating
+            //     an Attr node for the copy.
+            element_copy->append_attribute(attribute.qualified_name(), attribute.value());
         });
 
-        if (maybe_exception.has_value())
-            return *maybe_exception;
-
         copy = move(element_copy);
     }
 
@@ -1567,7 +1556,7 @@ void Node::set_document(Badge<Document>, Document& document)
     set_document(document);
 }
 
-void Node::set_document(Badge<NamedNodeMap>, Document& document)
+void Node::set_document(Badge<AttributeList>, Document& document)
 {
     set_document(document);
 }
@@ -2399,26 +2388,23 @@ Vector<FlyString> Node::get_in_scope_prefixes() const
             add_prefix(prefix);
         }
 
-        if (auto attributes = current->attributes()) {
-            for (size_t i = 0; i < attributes->length(); ++i) {
-                auto const* attr = attributes->item(i);
-                if (attr->namespace_uri() != Web::Namespace::XMLNS)
-                    continue;
-
-                Optional<FlyString> declared_prefix;
+        for (auto const& attr : current->attribute_list()) {
+            if (attr.namespace_uri() != Web::Namespace::XMLNS)
+                continue;
 
-                if (!attr->prefix().has_value() && attr->local_name() == "xmlns"_fly_string) {
-                    declared_prefix = ""_fly_string;
-                } else if (attr->prefix() == "xmlns"_fly_string) {
-                    declared_prefix = attr->local_name();
-                } else {
-                    continue;
-                }
+            Optional<FlyString> declared_prefix;
 
-                if (!attr->value().is_empty())
-                    add_prefix(*declared_prefix);
-                seen_prefixes.set(*declared_prefix); // Mark as seen even if the value is empty
+            if (!attr.prefix().has_value() && attr.local_name() == "xmlns"_fly_string) {
+                declared_prefix = ""_fly_string;
+            } else if (attr.prefix() == "xmlns"_fly_string) {
+                declared_prefix = attr.local_name();
+            } else {
+                continue;
             }
+
+            if (!attr.value().is_empty())
+                add_prefix(*declared_prefix);
+            seen_prefixes.set(*declared_prefix); // Mark as seen even if the value is empty
         }
 
         current = current->parent_element();
@@ -2450,17 +2436,14 @@ Optional<String> Node::locate_a_namespace(Optional<String> const& prefix) const
         // 4. If it has an attribute whose namespace is the XMLNS namespace, namespace prefix is "xmlns", and local name is prefix,
         //    or if prefix is null and it has an attribute whose namespace is the XMLNS namespace, namespace prefix is null,
         //    and local name is "xmlns", then return its value if it is not the empty string, and null otherwise.
-        if (auto attributes = element.attributes()) {
-            for (size_t i = 0; i < attributes->length(); ++i) {
-                auto& attr = *attributes->item(i);
-                if (attr.namespace_uri() == Web::Namespace::XMLNS) {
-                    if ((attr.prefix() == "xmlns" && attr.local_name() == prefix) || (!prefix.has_value() && !attr.prefix().has_value() && attr.local_name() == "xmlns")) {
-                        auto value = attr.value();
-                        if (!value.is_empty())
-                            return value;
-
-                        return {};
-                    }
+        for (auto const& attr : element.attribute_list()) {
+            if (attr.namespace_uri() == Web::Namespace::XMLNS) {
+                if ((attr.prefix() == "xmlns" && attr.local_name() == prefix) || (!prefix.has_value() && !attr.prefix().has_value() && attr.local_name() == "xmlns")) {
+                    auto value = attr.value();
+                    if (!value.is_empty())
+                        return value;
+
+                    return {};
                 }
             }
         }
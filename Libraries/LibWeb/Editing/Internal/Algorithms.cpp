@@ -2175,7 +2175,7 @@ bool is_modifiable_element(GC::Ref<DOM::Node> node)
     // possibly style;
     auto has_no_attributes_except = [&](auto exclusions) {
         auto attribute_count = 0;
-        html_element.for_each_attribute([&](DOM::Attr const& attribute) {
+        html_element.for_each_attribute([&](DOM::AttributeList::Entry const& attribute) {
             if (!exclusions.contains_slow(attribute.local_name()))
                 ++attribute_count;
         });
@@ -2380,7 +2380,7 @@ bool is_simple_indentation_element(GC::Ref<DOM::Node> node)
 
     // that has no attributes except possibly
     bool has_only_valid_attributes = true;
-    element.for_each_attribute([&](DOM::Attr const& attribute) {
+    element.for_each_attribute([&](DOM::AttributeList::Entry const& attribute) {
         // * a style attribute that sets no properties other than "margin", "border", "padding", or subproperties of
         //   those;
         if (attribute.local_name() == HTML::AttributeNames::style) {
@@ -83,6 +83,13 @@ static bool g_http_memory_cache_enabled = false;
         _temporary_result.release_value();                                                           \
     })
 
+// NB: Integrity checks of all fetches share one parallel queue, rather than each fetch starting its own.
+static HTML::ParallelQueue& integrity_check_queue()
+{
+    static auto s_queue = HTML::ParallelQueue::create();
+    return *s_queue;
+}
+
 class HTTPCache {
 public:
     HTTP::MemoryCache& get(Infrastructure::NetworkPartitionKey const& key)
@@ -677,18 +684,37 @@ GC::Ptr<PendingResponse> main_fetch(JS::Realm& realm, Infrastructure::FetchParam
                 }
 
                 // 3. Let processBody given bytes be these steps:
-                auto process_body = GC::create_function(vm.heap(), [&realm, request, response, &fetch_params, process_body_error](ByteBuffer bytes) {
-                    // 1. If bytes do not match request’s integrity metadata, then run processBodyError and abort these steps.
-                    if (!TRY_OR_IGNORE(SRI::do_bytes_match_metadata_list(bytes, request->integrity_metadata()))) {
-                        process_body_error->function()({});
-                        return;
-                    }
+                auto process_body = GC::create_function(vm.heap(), [&realm, &vm, request, response, &fetch_params, process_body_error](ByteBuffer bytes) {
+                    // NB: Hashing the whole body can take a while, so the integrity check is done on a background thread.
+                    //     The metadata is copied, as the request's string must not be shared with another thread.
+                    auto integrity_metadata = String::from_utf8_without_validation(request->integrity_metadata().bytes());
+
+                    auto check_integrity = [bytes = move(bytes), integrity_metadata = move(integrity_metadata)]() mutable -> Optional<ByteBuffer> {
+                        auto matches = SRI::do_bytes_match_metadata_list(bytes, integrity_metadata);
+                        if (matches.is_error() || !matches.value())
+                            return {};
+                        return move(bytes);
+                    };
+
+                    auto handle_integrity_check = GC::create_function(vm.heap(), [&realm, response, &fetch_params, process_body_error](Optional<ByteBuffer> bytes) {
+                        // 1. If bytes do not match request’s integrity metadata, then run processBodyError and abort these steps.
+                        if (!bytes.has_value()) {
+                            process_body_error->function()({});
+                            return;
+                        }
+
+                        // 2. Set response’s body to bytes as a body.
+                        response->set_body(Infrastructure::byte_sequence_as_body(realm, *bytes));
 
-                    // 2. Set response’s body to bytes as a body.
-                    response->set_body(Infrastructure::byte_sequence_as_body(realm, bytes));
+                        // 3. Run fetch response handover given fetchParams and response.
+                        fetch_response_handover(realm, fetch_params, *response);
+                    });
 
-                    // 3. Run fetch response handover given fetchParams and response.
-                    fetch_response_handover(realm, fetch_params, *response);
+                    integrity_check_queue().enqueue_in_parallel<Optional<ByteBuffer>>(move(check_integrity), [&vm, &fetch_params, handle_integrity_check = GC::make_root(handle_integrity_check)](Optional<ByteBuffer> bytes) mutable {
+                        Infrastructure::queue_fetch_task(fetch_params.controller(), fetch_params.task_destination(), GC::create_function(vm.heap(), [handle_integrity_check = GC::Ref { *handle_integrity_check }, bytes = move(bytes)]() mutable {
+                            handle_integrity_check->function()(move(bytes));
+                        }));
+                    });
                 });
 
                 // 4. Fully read response’s body given processBody and processBodyError.
@@ -519,6 +519,7 @@ class AbstractElement;
 class AbstractRange;
 class AccessibilityTreeNode;
 class Attr;
+class AttributeList;
 class CDATASection;
 class CharacterData;
 class Comment;
@@ -788,6 +789,8 @@ class HTMLTemplateElement;
 class HTMLTextAreaElement;
 class HTMLTimeElement;
 class HTMLTitleElement;
+class HTMLToken;
+class HTMLTokenizer;
 class HTMLTrackElement;
 class HTMLUListElement;
 class HTMLUnknownElement;
@@ -828,6 +831,7 @@ class SessionHistoryEntry;
 class SharedResourceRequest;
 class SharedWorker;
 class SharedWorkerGlobalScope;
+class SpeculativeHTMLParser;
 class Storage;
 class SubmitEvent;
 class TextMetrics;
@@ -1039,6 +1043,7 @@ namespace Web::Painting {
 
 class AudioPaintable;
 class CheckBoxPaintable;
+class CompositorAnimation;
 class FieldSetPaintable;
 class LabelablePaintable;
 class MediaPaintable;
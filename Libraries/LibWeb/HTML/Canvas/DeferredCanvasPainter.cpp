@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/TypeCasts.h>
+#include <LibGfx/PaintStyle.h>
+#include <LibWeb/HTML/Canvas/DeferredCanvasPainter.h>
+
+namespace Web::HTML {
+
+// Upper bound on the number of commands kept around between flushes, so that scripts that draw a lot without the
+// canvas ever being presented (e.g. in a background tab) don't grow the command list without bound.
+static constexpr size_t max_number_of_recorded_commands = 16384;
+
+DeferredCanvasPainter::DeferredCanvasPainter(NonnullOwnPtr<Gfx::Painter> target)
+    : m_target(move(target))
+{
+}
+
+DeferredCanvasPainter::~DeferredCanvasPainter() = default;
+
+bool DeferredCanvasPainter::can_be_deferred(Gfx::PaintStyle const& paint_style)
+{
+    // NB: Gradients and patterns can be changed by script after they have been used to draw, and that must not affect
+    //     what has already been drawn. Solid colors are immutable, so only those are recorded by reference.
+    return is<Gfx::SolidColorPaintStyle>(paint_style);
+}
+
+void DeferredCanvasPainter::append(Command command)
+{
+    // OPTIMIZATION: Only the last of several transform changes in a row affects any drawing, and a save immediately
+    //               followed by a restore has no effect at all.
+    if (!m_commands.is_empty()) {
+        if (command.has<SetTransform>() && m_commands.last().has<SetTransform>()) {
+            m_commands.last() = move(command);
+            return;
+        }
+        if (command.has<Restore>() && m_commands.last().has<Save>()) {
+            m_commands.take_last();
+            return;
+        }
+    }
+
+    m_commands.append(move(command));
+
+    if (m_commands.size() >= max_number_of_recorded_commands)
+        flush();
+}
+
+void DeferredCanvasPainter::flush()
+{
+    for (auto const& command : m_commands) {
+        command.visit(
+            [&](ClearRect const& command) {
+                m_target->clear_rect(command.rect, command.color);
+            },
+            [&](FillRect const& command) {
+                m_target->fill_rect(command.rect, command.color);
+            },
+            [&](DrawBitmap const& command) {
+                m_target->draw_bitmap(command.dst_rect, *command.bitmap, command.src_rect, command.scaling_mode, command.filter, command.global_alpha, command.compositing_and_blending_operator);
+            },
+            [&](StrokePathWithColor const& command) {
+                m_target->stroke_path(command.path, command.color, command.thickness);
+            },
+            [&](StrokePathWithColorAndBlur const& command) {
+                auto const& style = command.stroke_style;
+                m_target->stroke_path(command.path, command.color, command.thickness, command.blur_radius, command.compositing_and_blending_operator, style.cap_style, style.join_style, style.miter_limit, style.dash_array, style.dash_offset);
+            },
+            [&](StrokePathWithPaintStyle const& command) {
+                if (!command.stroke_style.has_value()) {
+                    m_target->stroke_path(command.path, *command.paint_style, command.filter, command.thickness, command.global_alpha, command.compositing_and_blending_operator);
+                    return;
+                }
+                auto const& style = *command.stroke_style;
+                m_target->stroke_path(command.path, *command.paint_style, command.filter, command.thickness, command.global_alpha, command.compositing_and_blending_operator, style.cap_style, style.join_style, style.miter_limit, style.dash_array, style.dash_offset);
+            },
+            [&](FillPathWithColor const& command) {
+                m_target->fill_path(command.path, command.color, command.winding_rule);
+            },
+            [&](FillPathWithColorAndBlur const& command) {
+                m_target->fill_path(command.path, command.color, command.winding_rule, command.blur_radius, command.compositing_and_blending_operator);
+            },
+            [&](FillPathWithPaintStyle const& command) {
+                m_target->fill_path(command.path, *command.paint_style, command.filter, command.global_alpha, command.compositing_and_blending_operator, command.winding_rule);
+            },
+            [&](SetTransform const& command) {
+                m_target->set_transform(command.transform);
+            },
+            [&](Save const&) {
+                m_target->save();
+            },
+            [&](Restore const&) {
+                m_target->restore();
+            },
+            [&](Clip const& command) {
+                m_target->clip(command.path, command.winding_rule);
+            },
+            [&](Reset const&) {
+                m_target->reset();
+            });
+    }
+    m_commands.clear_with_capacity();
+}
+
+void DeferredCanvasPainter::clear_rect(Gfx::FloatRect const& rect, Gfx::Color color)
+{
+    append(ClearRect { rect, color });
+}
+
+void DeferredCanvasPainter::fill_rect(Gfx::FloatRect const& rect, Gfx::Color color)
+{
+    append(FillRect { rect, color });
+}
+
+void DeferredCanvasPainter::draw_bitmap(Gfx::FloatRect const& dst_rect, Gfx::ImmutableBitmap const& src_bitmap, Gfx::IntRect const& src_rect, Gfx::ScalingMode scaling_mode, Optional<Gfx::Filter> filter, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
+{
+    append(DrawBitmap { dst_rect, src_bitmap, src_rect, scaling_mode, move(filter), global_alpha, compositing_and_blending_operator });
+}
+
+void DeferredCanvasPainter::stroke_path(Gfx::Path const& path, Gfx::Color color, float thickness)
+{
+    append(StrokePathWithColor { path, color, thickness });
+}
+
+void DeferredCanvasPainter::stroke_path(Gfx::Path const& path, Gfx::Color color, float thickness, float blur_radius, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator, Gfx::Path::CapStyle cap_style, Gfx::Path::JoinStyle join_style, float miter_limit, Vector<float> const& dash_array, float dash_offset)
+{
+    append(StrokePathWithColorAndBlur { path, color, thickness, blur_radius, compositing_and_blending_operator, { cap_style, join_style, miter_limit, dash_array, dash_offset } });
+}
+
+void DeferredCanvasPainter::stroke_path(Gfx::Path const& path, Gfx::PaintStyle const& paint_style, Optional<Gfx::Filter> filter, float thickness, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
+{
+    if (!can_be_deferred(paint_style)) {
+        flush();
+        m_target->stroke_path(path, paint_style, move(filter), thickness, global_alpha, compositing_and_blending_operator);
+        return;
+    }
+    append(StrokePathWithPaintStyle { path, paint_style, move(filter), thickness, global_alpha, compositing_and_blending_operator, {} });
+}
+
+void DeferredCanvasPainter::stroke_path(Gfx::Path const& path, Gfx::PaintStyle const& paint_style, Optional<Gfx::Filter> filter, float thickness, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator, Gfx::Path::CapStyle const& cap_style, Gfx::Path::JoinStyle const& join_style, float miter_limit, Vector<float> const& dash_array, float dash_offset)
+{
+    if (!can_be_deferred(paint_style)) {
+        flush();
+        m_target->stroke_path(path, paint_style, move(filter), thickness, global_alpha, compositing_and_blending_operator, cap_style, join_style, miter_limit, dash_array, dash_offset);
+        return;
+    }
+    append(StrokePathWithPaintStyle { path, paint_style, move(filter), thickness, global_alpha, compositing_and_blending_operator, StrokeStyle { cap_style, join_style, miter_limit, dash_array, dash_offset } });
+}
+
+void DeferredCanvasPainter::fill_path(Gfx::Path const& path, Gfx::Color color, Gfx::WindingRule winding_rule)
+{
+    append(FillPathWithColor { path, color, winding_rule });
+}
+
+void DeferredCanvasPainter::fill_path(Gfx::Path const& path, Gfx::Color color, Gfx::WindingRule winding_rule, float blur_radius, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
+{
+    append(FillPathWithColorAndBlur { path, color, winding_rule, blur_radius, compositing_and_blending_operator });
+}
+
+void DeferredCanvasPainter::fill_path(Gfx::Path const& path, Gfx::PaintStyle const& paint_style, Optional<Gfx::Filter> filter, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator, Gfx::WindingRule winding_rule)
+{
+    if (!can_be_deferred(paint_style)) {
+        flush();
+        m_target->fill_path(path, paint_style, move(filter), global_alpha, compositing_and_blending_operator, winding_rule);
+        return;
+    }
+    append(FillPathWithPaintStyle { path, paint_style, move(filter), global_alpha, compositing_and_blending_operator, winding_rule });
+}
+
+void DeferredCanvasPainter::set_transform(Gfx::AffineTransform const& transform)
+{
+    append(SetTransform { transform });
+}
+
+void DeferredCanvasPainter::save()
+{
+    append(Save {});
+}
+
+void DeferredCanvasPainter::restore()
+{
+    append(Restore {});
+}
+
+void DeferredCanvasPainter::clip(Gfx::Path const& path, Gfx::WindingRule winding_rule)
+{
+    append(Clip { path, winding_rule });
+}
+
+void DeferredCanvasPainter::reset()
+{
+    append(Reset {});
+}
+
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibGfx/AffineTransform.h>
+#include <LibGfx/Color.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/Painter.h>
+#include <LibGfx/Rect.h>
+
+namespace Web::HTML {
+
+// Records the draw calls of a canvas rendering context as a list of commands instead of painting them right away, and
+// plays them back onto the painter of the canvas surface in one go when flushed. The owner must flush before anything
+// reads or writes the pixels of the surface directly, and before the surface is presented for rendering.
+class DeferredCanvasPainter final : public Gfx::Painter {
+public:
+    explicit DeferredCanvasPainter(NonnullOwnPtr<Gfx::Painter>);
+    virtual ~DeferredCanvasPainter() override;
+
+    virtual void clear_rect(Gfx::FloatRect const&, Gfx::Color) override;
+    virtual void fill_rect(Gfx::FloatRect const&, Gfx::Color) override;
+    virtual void draw_bitmap(Gfx::FloatRect const& dst_rect, Gfx::ImmutableBitmap const& src_bitmap, Gfx::IntRect const& src_rect, Gfx::ScalingMode, Optional<Gfx::Filter>, float global_alpha, Gfx::CompositingAndBlendingOperator) override;
+    virtual void stroke_path(Gfx::Path const&, Gfx::Color, float thickness) override;
+    virtual void stroke_path(Gfx::Path const&, Gfx::Color, float thickness, float blur_radius, Gfx::CompositingAndBlendingOperator, Gfx::Path::CapStyle, Gfx::Path::JoinStyle, float miter_limit, Vector<float> const& dash_array, float dash_offset) override;
+    virtual void stroke_path(Gfx::Path const&, Gfx::PaintStyle const&, Optional<Gfx::Filter>, float thickness, float global_alpha, Gfx::CompositingAndBlendingOperator) override;
+    virtual void stroke_path(Gfx::Path const&, Gfx::PaintStyle const&, Optional<Gfx::Filter>, float thickness, float global_alpha, Gfx::CompositingAndBlendingOperator, Gfx::Path::CapStyle const&, Gfx::Path::JoinStyle const&, float miter_limit, Vector<float> const& dash_array, float dash_offset) override;
+    virtual void fill_path(Gfx::Path const&, Gfx::Color, Gfx::WindingRule) override;
+    virtual void fill_path(Gfx::Path const&, Gfx::Color, Gfx::WindingRule, float blur_radius, Gfx::CompositingAndBlendingOperator) override;
+    virtual void fill_path(Gfx::Path const&, Gfx::PaintStyle const&, Optional<Gfx::Filter>, float global_alpha, Gfx::CompositingAndBlendingOperator, Gfx::WindingRule) override;
+    virtual void set_transform(Gfx::AffineTransform const&) override;
+    virtual void save() override;
+    virtual void restore() override;
+    virtual void clip(Gfx::Path const&, Gfx::WindingRule) override;
+    virtual void reset() override;
+
+    // Plays back all recorded commands onto the target painter.
+    void flush();
+
+private:
+    struct ClearRect {
+        Gfx::FloatRect rect;
+        Gfx::Color color;
+    };
+
+    struct FillRect {
+        Gfx::FloatRect rect;
+        Gfx::Color color;
+    };
+
+    struct DrawBitmap {
+        Gfx::FloatRect dst_rect;
+        NonnullRefPtr<Gfx::ImmutableBitmap const> bitmap;
+        Gfx::IntRect src_rect;
+        Gfx::ScalingMode scaling_mode;
+        Optional<Gfx::Filter> filter;
+        float global_alpha;
+        Gfx::CompositingAndBlendingOperator compositing_and_blending_operator;
+    };
+
+    struct StrokeStyle {
+        Gfx::Path::CapStyle cap_style;
+        Gfx::Path::JoinStyle join_style;
+        float miter_limit;
+        Vector<float> dash_array;
+        float dash_offset;
+    };
+
+    struct StrokePathWithColor {
+        Gfx::Path path;
+        Gfx::Color color;
+        float thickness;
+    };
+
+    struct StrokePathWithColorAndBlur {
+        Gfx::Path path;
+        Gfx::Color color;
+        float thickness;
+        float blur_radius;
+        Gfx::CompositingAndBlendingOperator compositing_and_blending_operator;
+        StrokeStyle stroke_style;
+    };
+
+    struct StrokePathWithPaintStyle {
+        Gfx::Path path;
+        NonnullRefPtr<Gfx::PaintStyle const> paint_style;
+        Optional<Gfx::Filter> filter;
+        float thickness;
+        float global_alpha;
+        Gfx::CompositingAndBlendingOperator compositing_and_blending_operator;
+        Optional<StrokeStyle> stroke_style;
+    };
+
+    struct FillPathWithColor {
+        Gfx::Path path;
+        Gfx::Color color;
+        Gfx::WindingRule winding_rule;
+    };
+
+    struct FillPathWithColorAndBlur {
+        Gfx::Path path;
+        Gfx::Color color;
+        Gfx::WindingRule winding_rule;
+        float blur_radius;
+        Gfx::CompositingAndBlendingOperator compositing_and_blending_operator;
+    };
+
+    struct FillPathWithPaintStyle {
+        Gfx::Path path;
+        NonnullRefPtr<Gfx::PaintStyle const> paint_style;
+        Optional<Gfx::Filter> filter;
+        float global_alpha;
+        Gfx::CompositingAndBlendingOperator compositing_and_blending_operator;
+        Gfx::WindingRule winding_rule;
+    };
+
+    struct SetTransform {
+        Gfx::AffineTransform transform;
+    };
+
+    struct Save { };
+
+    struct Restore { };
+
+    struct Clip {
+        Gfx::Path path;
+        Gfx::WindingRule winding_rule;
+    };
+
+    struct Reset { };
+
+    using Command = Variant<
+        ClearRect,
+        FillRect,
+        DrawBitmap,
+        StrokePathWithColor,
+        StrokePathWithColorAndBlur,
+        StrokePathWithPaintStyle,
+        FillPathWithColor,
+        FillPathWithColorAndBlur,
+        FillPathWithPaintStyle,
+        SetTransform,
+        Save,
+        Restore,
+        Clip,
+        Reset>;
+
+    void append(Command);
+
+    [[nodiscard]] static bool can_be_deferred(Gfx::PaintStyle const&);
+
+    NonnullOwnPtr<Gfx::Painter> m_target;
+    Vector<Command> m_commands;
+};
+
+}
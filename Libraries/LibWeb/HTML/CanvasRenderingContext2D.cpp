@@ -14,6 +14,7 @@
 #include <LibGfx/CompositingAndBlendingOperator.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/PainterSkia.h>
+#include <LibGfx/PaintingSurface.h>
 #include <LibGfx/Rect.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -221,14 +222,23 @@ void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
 Gfx::Painter* CanvasRenderingContext2D::painter()
 {
     allocate_painting_surface_if_needed();
-    auto surface = canvas_element().surface();
-    if (!m_painter && surface) {
+    if (!m_painter && m_surface) {
         canvas_element().document().invalidate_display_list();
-        m_painter = make<Gfx::PainterSkia>(*canvas_element().surface());
+        m_painter = make<DeferredCanvasPainter>(make<Gfx::PainterSkia>(*m_surface));
     }
     return m_painter.ptr();
 }
 
+RefPtr<Gfx::PaintingSurface> CanvasRenderingContext2D::surface()
+{
+    // NB: Draw calls are only recorded by the painter, so play them back before anyone gets to see the pixels of the
+    //     surface. This covers presenting the canvas for rendering, toDataURL(), toBlob(), getImageData(),
+    //     putImageData() and drawing this canvas onto another one.
+    if (m_painter)
+        m_painter->flush();
+    return m_surface;
+}
+
 void CanvasRenderingContext2D::set_size(Gfx::IntSize const& size)
 {
     if (m_size == size)
@@ -246,11 +256,15 @@ void CanvasRenderingContext2D::allocate_painting_surface_if_needed()
     // FIXME: implement context attribute .color_space
     // FIXME: implement context attribute .color_type
     // FIXME: implement context attribute .desynchronized
-    // FIXME: implement context attribute .will_read_frequently
 
     auto color_type = m_context_attributes.alpha ? Gfx::BitmapFormat::BGRA8888 : Gfx::BitmapFormat::BGRx8888;
 
-    auto skia_backend_context = canvas_element().navigable()->traversable_navigable()->skia_backend_context();
+    // https://html.spec.whatwg.org/multipage/canvas.html#concept-canvas-will-read-frequently
+    // When the author expects to read back pixels frequently, keep the bitmap in memory instead of on the GPU, so that
+    // getImageData() doesn't have to wait for the GPU every time.
+    RefPtr<Gfx::SkiaBackendContext> skia_backend_context;
+    if (!m_context_attributes.will_read_frequently)
+        skia_backend_context = canvas_element().navigable()->traversable_navigable()->skia_backend_context();
     m_surface = Gfx::PaintingSurface::create_with_size(skia_backend_context, canvas_element().bitmap_size_for_canvas(), color_type, Gfx::AlphaType::Premultiplied);
     m_painter = nullptr;
 
@@ -526,9 +540,9 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     auto image_data = TRY(ImageData::create(realm(), abs_width, abs_height, settings));
 
     // NOTE: We don't attempt to create the underlying bitmap here; if it doesn't exist, it's like copying only transparent black pixels (which is a no-op).
-    if (!canvas_element().surface())
+    auto surface = canvas_element().surface();
+    if (!surface)
         return image_data;
-    auto const snapshot = Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*canvas_element().surface());
 
     // 5. Let the source rectangle be the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
     auto source_rect = Gfx::Rect { x, y, abs_width, abs_height };
@@ -539,20 +553,18 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     if (width < 0 || height < 0) {
         source_rect = source_rect.translated(min(width, 0), min(height, 0));
     }
-    auto source_rect_intersected = source_rect.intersected(snapshot->rect());
 
     // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
     // NOTE: Internally we must use premultiplied alpha, but ImageData should hold unpremultiplied alpha. This conversion
     //       might result in a loss of precision, but is according to spec.
     //       See: https://html.spec.whatwg.org/multipage/canvas.html#premultiplied-alpha-and-the-2d-rendering-context
-    VERIFY(snapshot->alpha_type() == Gfx::AlphaType::Premultiplied);
+    // NOTE: Only the source rectangle is read back from the surface, so that small reads don't cost as much as
+    //       copying the whole canvas.
     VERIFY(image_data->bitmap().alpha_type() == Gfx::AlphaType::Unpremultiplied);
-
-    auto painter = Gfx::Painter::create(image_data->bitmap());
-    painter->draw_bitmap(image_data->bitmap().rect().to_type<float>(), *snapshot, source_rect_intersected, Gfx::ScalingMode::NearestNeighbor, {}, 1, Gfx::CompositingAndBlendingOperator::SourceOver);
+    surface->read_into_bitmap(image_data->bitmap(), source_rect.location());
 
     // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
-    // NOTE: No-op, already done during creation.
+    // NOTE: No-op, already done during creation, and the pixels outside of the output bitmap are not read.
 
     // 8. Return imageData.
     return image_data;
@@ -563,8 +575,8 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_image_data(ImageData& im
 {
     // The putImageData(imageData, dx, dy) method steps are to put pixels from an ImageData onto a bitmap,
     // given imageData, this's output bitmap, dx, dy, 0, 0, imageData's width, and imageData's height.
-    if (auto* painter = this->painter())
-        TRY(put_pixels_from_an_image_data_onto_a_bitmap(image_data, *painter, dx, dy, 0, 0, image_data.width(), image_data.height()));
+    if (painter())
+        TRY(put_pixels_from_an_image_data_onto_a_bitmap(image_data, *canvas_element().surface(), dx, dy, 0, 0, image_data.width(), image_data.height()));
 
     return {};
 }
@@ -575,14 +587,14 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_image_data(ImageData& im
     // The putImageData(imageData, dx, dy, dirtyX, dirtyY, dirtyWidth, dirtyHeight) method steps are to put pixels
     // from an ImageData onto a bitmap, given imageData, this's output bitmap, dx, dy, dirtyX, dirtyY, dirtyWidth, and
     // dirtyHeight.
-    if (auto* painter = this->painter())
-        TRY(put_pixels_from_an_image_data_onto_a_bitmap(image_data, *painter, x, y, dirty_x, dirty_y, dirty_width, dirty_height));
+    if (painter())
+        TRY(put_pixels_from_an_image_data_onto_a_bitmap(image_data, *canvas_element().surface(), x, y, dirty_x, dirty_y, dirty_width, dirty_height));
 
     return {};
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-context2d-putimagedata-common
-WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_pixels_from_an_image_data_onto_a_bitmap(ImageData& image_data, Gfx::Painter& painter, float dx, float dy, float dirty_x, float dirty_y, float dirty_width, float dirty_height)
+WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_pixels_from_an_image_data_onto_a_bitmap(ImageData& image_data, Gfx::PaintingSurface& surface, float dx, float dy, float dirty_x, float dirty_y, float dirty_width, float dirty_height)
 {
     // 1. Let buffer be imageData's data attribute value's [[ViewedArrayBuffer]] internal slot.
     auto* buffer = image_data.data()->viewed_array_buffer();
@@ -636,20 +648,14 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_pixels_from_an_image_dat
     //    set the pixel with coordinate (dx+x, dy+y) in bitmap to the color of the pixel at coordinate (x, y) in the
     //    imageData data structure's bitmap, converted from imageData's colorSpace to the color space of bitmap using
     //    'relative-colorimetric' rendering intent.
-    auto dst_rect = Gfx::FloatRect { dx + dirty_x, dy + dirty_y, dirty_width, dirty_height };
-    painter.save();
-    painter.set_transform({});
-    painter.draw_bitmap(
-        dst_rect,
-        Gfx::ImmutableBitmap::create(image_data.bitmap(), Gfx::AlphaType::Unpremultiplied),
-        Gfx::IntRect { dirty_x, dirty_y, dirty_width, dirty_height },
-        Gfx::ScalingMode::NearestNeighbor,
-        {},
-        1.0f,
-        Gfx::CompositingAndBlendingOperator::SourceOver);
-    painter.restore();
-
-    did_draw(dst_rect);
+    // NOTE: The pixels are written straight into the surface, which replaces the affected pixels without being subject
+    //       to the current transform, clipping region or compositing, and touches nothing outside of the dirty rect.
+    auto source_rect = Gfx::IntRect { dirty_x, dirty_y, dirty_width, dirty_height };
+    auto destination = Gfx::IntPoint { dx + dirty_x, dy + dirty_y };
+    VERIFY(image_data.bitmap().alpha_type() == Gfx::AlphaType::Unpremultiplied);
+    surface.write_from_bitmap(image_data.bitmap(), source_rect, destination);
+
+    did_draw(Gfx::FloatRect { destination.to_type<float>(), source_rect.size().to_type<float>() });
 
     return {};
 }
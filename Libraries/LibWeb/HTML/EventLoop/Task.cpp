@@ -5,6 +5,7 @@
  */
 
 #include <AK/IDAllocator.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 
@@ -90,4 +91,35 @@ TaskID ParallelQueue::enqueue(GC::Ref<GC::Function<void()>> algorithm)
     return task->id();
 }
 
+void ParallelQueue::enqueue_steps_in_parallel(Function<void()> steps, Function<void()> on_complete)
+{
+    m_steps_in_parallel.enqueue({ move(steps), move(on_complete) });
+    if (!m_is_running_steps_in_parallel)
+        run_next_steps_in_parallel();
+}
+
+void ParallelQueue::run_next_steps_in_parallel()
+{
+    if (m_steps_in_parallel.is_empty()) {
+        m_is_running_steps_in_parallel = false;
+        return;
+    }
+
+    // NB: Background actions may run on any worker thread, so the next steps are only started once the previous ones
+    //     have completed. This keeps the steps of a parallel queue in order.
+    m_is_running_steps_in_parallel = true;
+    auto next = m_steps_in_parallel.dequeue();
+
+    (void)Threading::BackgroundAction<Empty>::construct(
+        [steps = move(next.steps)](auto&) -> ErrorOr<Empty> {
+            steps();
+            return Empty {};
+        },
+        [self = NonnullRefPtr { *this }, on_complete = move(next.on_complete)](Empty) mutable -> ErrorOr<void> {
+            on_complete();
+            self->run_next_steps_in_parallel();
+            return {};
+        });
+}
+
 }
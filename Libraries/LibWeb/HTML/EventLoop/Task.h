@@ -7,7 +7,11 @@
 #pragma once
 
 #include <AK/DistinctNumeric.h>
+#include <AK/Function.h>
+#include <AK/OwnPtr.h>
+#include <AK/Queue.h>
 #include <LibGC/CellAllocator.h>
+#include <LibGC/Function.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
@@ -123,12 +127,39 @@ struct WEB_API UniqueTaskSource {
     Task::Source const source;
 };
 
+// https://html.spec.whatwg.org/multipage/infrastructure.html#parallel-queue
 class WEB_API ParallelQueue : public RefCounted<ParallelQueue> {
 public:
     static NonnullRefPtr<ParallelQueue> create();
+
+    // Enqueues an algorithm that may touch the JS heap. It runs as a task on the event loop.
     TaskID enqueue(GC::Ref<GC::Function<void()>>);
 
+    // Enqueues steps that do not touch the JS heap. They run on a background thread, one at a time and in the order in
+    // which they were enqueued. on_complete is then called with their result on the event loop's thread; it is up to
+    // the caller to queue a task from there if the result needs to touch the heap.
+    template<typename Result>
+    void enqueue_in_parallel(Function<Result()> steps, Function<void(Result)> on_complete)
+    {
+        auto result = make<Optional<Result>>();
+        auto* result_slot = result.ptr();
+
+        enqueue_steps_in_parallel(
+            [steps = move(steps), result_slot] { *result_slot = steps(); },
+            [on_complete = move(on_complete), result = move(result)] mutable { on_complete(result->release_value()); });
+    }
+
 private:
+    void enqueue_steps_in_parallel(Function<void()> steps, Function<void()> on_complete);
+    void run_next_steps_in_parallel();
+
+    struct StepsInParallel {
+        Function<void()> steps;
+        Function<void()> on_complete;
+    };
+    Queue<StepsInParallel> m_steps_in_parallel;
+    bool m_is_running_steps_in_parallel { false };
+
     UniqueTaskSource m_task_source;
 };
 
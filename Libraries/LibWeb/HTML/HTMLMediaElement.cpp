@@ -999,6 +999,11 @@ void HTMLMediaElement::fetch_resource(URL::URL const& url_record, Function<void(
             return;
         self->restart_fetch_at_offset(fetch_data, offset);
     });
+    fetch_data->stream->set_pause_request_callback([self = GC::Weak(*this), &fetch_data = *fetch_data] {
+        if (!self)
+            return;
+        self->pause_fetch(fetch_data);
+    });
     fetch_data->failure_callback = [&stream = *fetch_data->stream, failure_callback = move(failure_callback)](String error_message) {
         // Ensure that we unblock any reads if we stop the fetch due to some failure.
         stream.close();
@@ -1115,6 +1120,9 @@ void HTMLMediaElement::fetch_resource(NonnullRefPtr<FetchData> const& fetch_data
             if (auto accept_ranges = response->header_list()->extract_header_list_values("Accept-Ranges"sv); accept_ranges.template has<Vector<ByteString>>())
                 fetch_data->accepts_byte_ranges = accept_ranges.template get<Vector<ByteString>>().contains([](auto const& units) { return units == "bytes"sv; });
 
+            // Evicted media data can only be fetched again if the server supports range requests.
+            fetch_data->stream->set_data_eviction_enabled(fetch_data->accepts_byte_ranges);
+
             // 4. If the result of verifying response given the current media resource and byteRange is false, then abort these steps.
             // NOTE: We do this step before creating the updateMedia task so that we can invoke the failure callback.
             auto maybe_verify_response_failure = weak_self->verify_response_or_get_failure_reason(response, byte_range, fetch_data);
@@ -1234,6 +1242,14 @@ void HTMLMediaElement::restart_fetch_at_offset(FetchData& fetch_data, u64 offset
     fetch_resource(fetch_data, UntilEnd { offset });
 }
 
+void HTMLMediaElement::pause_fetch(FetchData& fetch_data)
+{
+    // The fetch can only be resumed later if the server supports range requests.
+    if (!fetch_data.accepts_byte_ranges)
+        return;
+    cancel_the_fetching_process();
+}
+
 void HTMLMediaElement::set_audio_track_enabled(Badge<AudioTrack>, GC::Ptr<HTML::AudioTrack> audio_track, bool enabled)
 {
     if (enabled)
@@ -213,6 +213,7 @@ private:
     Optional<String> verify_response_or_get_failure_reason(GC::Ref<Fetch::Infrastructure::Response>, ByteRange const&, NonnullRefPtr<FetchData> const&);
 
     void restart_fetch_at_offset(FetchData&, u64 offset);
+    void pause_fetch(FetchData&);
 
     void set_up_playback_manager(NonnullRefPtr<FetchData> const&);
     enum class FetchingStatus {
@@ -51,12 +51,14 @@
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Loader/GeneratedPagesLoader.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/CompositorAnimation.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
 #include <LibWeb/Painting/NavigableContainerViewportPaintable.h>
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Selection/Selection.h>
+#include <LibWeb/UIEvents/KeyCode.h>
 #include <LibWeb/XHR/FormData.h>
 
 namespace Web::HTML {
@@ -2611,6 +2613,10 @@ void Navigable::perform_scroll_of_viewport_scrolling_box(CSSPixelPoint new_posit
         m_viewport_scroll_offset = new_position;
         scroll_offset_did_change();
 
+        // NB: Unless we are catching up with the rendering thread, it no longer knows where to scroll the viewport from.
+        if (m_asynchronous_scroll_state.has_value() && m_asynchronous_scroll_state->scroll_offset != new_position)
+            m_asynchronous_scroll_state.clear();
+
         if (auto document = active_document()) {
             document->set_needs_display(InvalidateDisplayList::No);
             document->set_needs_to_refresh_scroll_state(true);
@@ -2841,7 +2847,119 @@ void Navigable::record_display_list_and_scroll_state(PaintConfig paint_config)
         return TraversalDecision::Continue;
     });
 
-    m_rendering_thread.update_display_list(*display_list, move(scroll_state_snapshot_by_display_list));
+    // NB: Only the animations and the viewport scrolling of the top-level document run on the rendering thread, as the
+    //     display lists of nested navigables are recorded into it.
+    Vector<NonnullRefPtr<Painting::CompositorAnimation const>> compositor_animations;
+    if (is_top_level_traversable()) {
+        compositor_animations = document->compositor_animations();
+        update_asynchronous_scroll_state(*document, document_paintable.scroll_state_snapshot());
+    }
+
+    m_rendering_thread.update_display_list(*display_list, move(scroll_state_snapshot_by_display_list), move(compositor_animations));
+}
+
+static bool is_scrolled_with_scroll_frame(RefPtr<Painting::AccumulatedVisualContext const> visual_context, size_t scroll_frame_id)
+{
+    for (; visual_context; visual_context = visual_context->parent()) {
+        if (auto const* scroll_data = visual_context->data().get_pointer<Painting::ScrollData>(); scroll_data && scroll_data->scroll_frame_id == scroll_frame_id)
+            return true;
+    }
+    return false;
+}
+
+void Navigable::update_asynchronous_scroll_state(DOM::Document& document, Painting::ScrollStateSnapshot const& scroll_state_snapshot)
+{
+    m_asynchronous_scroll_state.clear();
+
+    // NB: Sticky positioned boxes, wheel event listeners that could cancel scrolling, and a zoomed-in visual viewport
+    //     all need the main thread to decide what a wheel event does, so we don't scroll asynchronously in those cases.
+    if (document.has_non_passive_wheel_event_listeners() || !document.visual_viewport()->transform().is_identity())
+        return;
+
+    auto& viewport_paintable = *document.paintable();
+    auto viewport_scroll_frame = viewport_paintable.own_scroll_frame();
+    auto scrollable_overflow_rect = viewport_paintable.scrollable_overflow_rect();
+    if (!viewport_scroll_frame || !scrollable_overflow_rect.has_value() || !viewport_paintable.could_be_scrolled_by_wheel_event())
+        return;
+
+    bool has_sticky_frames = false;
+    viewport_paintable.scroll_state().for_each_sticky_frame([&](auto const&) { has_sticky_frames = true; });
+    if (has_sticky_frames)
+        return;
+
+    AsynchronousScrollState state;
+    state.scroll_frame_id = viewport_scroll_frame->id();
+    state.scroll_offset = m_viewport_scroll_offset;
+    state.scroll_offset_at_update = m_viewport_scroll_offset;
+    state.max_scroll_offset = {
+        max(CSSPixels(0), scrollable_overflow_rect->width() - m_viewport_size.width()),
+        max(CSSPixels(0), scrollable_overflow_rect->height() - m_viewport_size.height()),
+    };
+
+    // Wheel events over nested scroll containers and navigables may scroll those instead of the viewport.
+    viewport_paintable.for_each_in_subtree_of_type<Painting::PaintableBox>([&](auto const& paintable_box) {
+        auto is_navigable_container = is<Painting::NavigableContainerViewportPaintable>(paintable_box);
+        if (!is_navigable_container && !(paintable_box.own_scroll_frame() && paintable_box.could_be_scrolled_by_wheel_event()))
+            return TraversalDecision::Continue;
+
+        auto visual_context = paintable_box.accumulated_visual_context();
+        auto rect = paintable_box.absolute_border_box_rect();
+        if (visual_context)
+            rect = visual_context->transform_rect_to_viewport(rect, scroll_state_snapshot);
+
+        if (is_scrolled_with_scroll_frame(visual_context, state.scroll_frame_id))
+            state.regions_scrolled_with_viewport.append(rect);
+        else
+            state.fixed_regions.append(rect);
+        return TraversalDecision::Continue;
+    });
+
+    m_asynchronous_scroll_state = move(state);
+}
+
+// Scrolls the viewport of the last recorded display list on the rendering thread, if the wheel event at the given
+// position would certainly end up scrolling it. Returns the delta that was applied, which the main thread syncs back
+// into the viewport's scroll offset once it gets to handle the event.
+Optional<CSSPixelPoint> Navigable::scroll_viewport_asynchronously(CSSPixelPoint position, unsigned modifiers, CSSPixelPoint delta)
+{
+    if (!m_asynchronous_scroll_state.has_value())
+        return {};
+    auto& state = *m_asynchronous_scroll_state;
+
+    if (modifiers & UIEvents::KeyModifier::Mod_Shift)
+        delta = { delta.y(), delta.x() };
+
+    auto is_in_region_scrolled_on_main_thread = [&] {
+        auto distance_scrolled_since_update = state.scroll_offset - state.scroll_offset_at_update;
+        for (auto const& region : state.regions_scrolled_with_viewport) {
+            if (region.translated(-distance_scrolled_since_update).contains(position))
+                return true;
+        }
+        for (auto const& region : state.fixed_regions) {
+            if (region.contains(position))
+                return true;
+        }
+        return false;
+    };
+
+    // NB: Once an event has been left to the main thread, later ones must be too until the next update, so that the
+    //     events are applied in order.
+    if (is_in_region_scrolled_on_main_thread()) {
+        m_asynchronous_scroll_state.clear();
+        return {};
+    }
+
+    auto new_scroll_offset = state.scroll_offset + delta;
+    new_scroll_offset.set_x(clamp(new_scroll_offset.x(), CSSPixels(0), state.max_scroll_offset.x()));
+    new_scroll_offset.set_y(clamp(new_scroll_offset.y(), CSSPixels(0), state.max_scroll_offset.y()));
+
+    auto applied_delta = new_scroll_offset - state.scroll_offset;
+    if (applied_delta.is_zero())
+        return {};
+
+    state.scroll_offset = new_scroll_offset;
+    m_rendering_thread.scroll(state.scroll_frame_id, -new_scroll_offset);
+    return applied_delta;
 }
 
 void Navigable::paint_next_frame()
@@ -227,6 +227,8 @@ public:
 
     GC::Ref<WebIDL::Promise> scroll_viewport_by_delta(CSSPixelPoint delta);
     GC::Ref<WebIDL::Promise> perform_a_scroll_of_the_viewport(CSSPixelPoint position);
+    Optional<CSSPixelPoint> scroll_viewport_asynchronously(CSSPixelPoint position, unsigned modifiers, CSSPixelPoint delta);
+    void invalidate_asynchronous_scroll_state() { m_asynchronous_scroll_state.clear(); }
     void reset_zoom();
 
 protected:
@@ -245,6 +247,8 @@ private:
 
     void reset_cursor_blink_cycle();
 
+    void update_asynchronous_scroll_state(DOM::Document&, Painting::ScrollStateSnapshot const&);
+
     void scroll_offset_did_change();
 
     void inform_the_navigation_api_about_aborting_navigation();
@@ -292,6 +296,21 @@ private:
     GC::Ref<Painting::BackingStoreManager> m_backing_store_manager;
     RefPtr<Gfx::SkiaBackendContext> m_skia_backend_context;
     RenderingThread m_rendering_thread;
+
+    // What is needed to scroll the viewport of the last recorded display list on the rendering thread, without
+    // waiting for the main thread to update the rendering.
+    struct AsynchronousScrollState {
+        size_t scroll_frame_id { 0 };
+        CSSPixelPoint scroll_offset;
+        CSSPixelPoint scroll_offset_at_update;
+        CSSPixelPoint max_scroll_offset;
+
+        // Regions where the wheel could scroll something other than the viewport, in viewport coordinates at the time
+        // of the update. The first ones move along with the viewport's scroll offset, the others stay in place.
+        Vector<CSSPixelRect> regions_scrolled_with_viewport;
+        Vector<CSSPixelRect> fixed_regions;
+    };
+    Optional<AsynchronousScrollState> m_asynchronous_scroll_state;
 };
 
 WEB_API HashTable<GC::RawRef<Navigable>>& all_navigables();
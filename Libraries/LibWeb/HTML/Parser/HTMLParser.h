@@ -161,6 +161,9 @@ private:
     void decrement_script_nesting_level();
     void reset_the_insertion_mode_appropriately();
 
+    void start_the_speculative_html_parser();
+    void stop_the_speculative_html_parser();
+
     void handle_element_popped(DOM::Element&);
 
     void adjust_mathml_attributes(HTMLToken&);
@@ -211,6 +214,11 @@ private:
     GC::Ptr<HTMLFormElement> m_form_element;
     GC::Ptr<DOM::Element> m_context_element;
 
+    // https://html.spec.whatwg.org/multipage/parsing.html#active-speculative-html-parser
+    // NOTE: The speculative parser is kept around between parser-blocking scripts so it can avoid refetching and
+    //       rescanning; it is only the "active speculative HTML parser" while its is_active() returns true.
+    GC::Ptr<SpeculativeHTMLParser> m_speculative_html_parser;
+
     Vector<HTMLToken> m_pending_table_character_tokens;
 
     GC::Ptr<DOM::Text> m_character_insertion_node;
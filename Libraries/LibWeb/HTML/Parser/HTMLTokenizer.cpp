@@ -2896,6 +2896,14 @@ HTMLTokenizer::HTMLTokenizer(StringView input, ByteString const& encoding)
     m_source_positions.empend(0u, 0u);
 }
 
+HTMLTokenizer::HTMLTokenizer(ReadonlySpan<u32> decoded_input)
+{
+    m_decoded_input.append(decoded_input.data(), decoded_input.size());
+    m_current_offset = 0;
+    m_prev_offset = 0;
+    m_source_positions.empend(0u, 0u);
+}
+
 void HTMLTokenizer::parser_did_run(Badge<HTMLParser>)
 {
     // OPTIMIZATION: If we've consumed all input and the insertion point is at the start,
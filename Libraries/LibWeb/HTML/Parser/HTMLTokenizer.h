@@ -107,6 +107,9 @@ public:
     explicit HTMLTokenizer();
     explicit HTMLTokenizer(StringView input, ByteString const& encoding);
 
+    // Creates a tokenizer over already-decoded input, as used by the speculative HTML parser.
+    explicit HTMLTokenizer(ReadonlySpan<u32> decoded_input);
+
     enum class State {
 #define __ENUMERATE_TOKENIZER_STATE(state) state,
         ENUMERATE_TOKENIZER_STATES
@@ -132,6 +135,9 @@ public:
 
     auto const& source() const { return m_source; }
 
+    ReadonlySpan<u32> unconsumed_input() const { return m_decoded_input.span().slice(m_current_offset); }
+    size_t input_length() const { return m_decoded_input.size(); }
+
     void insert_input_at_insertion_point(StringView input);
     void insert_eof();
     bool is_eof_inserted();
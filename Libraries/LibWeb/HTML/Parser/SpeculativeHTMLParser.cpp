@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/FetchController.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/HTMLToken.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/Parser/SpeculativeHTMLParser.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/SharedResourceRequest.h>
+#include <LibWeb/HTML/SourceSet.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/MimeSniff/MimeType.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/ReferrerPolicy/ReferrerPolicy.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(SpeculativeHTMLParser);
+
+GC::Ref<SpeculativeHTMLParser> SpeculativeHTMLParser::create(DOM::Document& document)
+{
+    return document.realm().create<SpeculativeHTMLParser>(document);
+}
+
+SpeculativeHTMLParser::SpeculativeHTMLParser(DOM::Document& document)
+    : m_document(document)
+{
+}
+
+SpeculativeHTMLParser::~SpeculativeHTMLParser() = default;
+
+void SpeculativeHTMLParser::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_document);
+    visitor.visit(m_fetch_controllers);
+    visitor.visit(m_image_requests);
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+void SpeculativeHTMLParser::start(HTMLTokenizer const& main_tokenizer)
+{
+    m_active = true;
+
+    auto unconsumed_input = main_tokenizer.unconsumed_input();
+
+    // OPTIMIZATION: Pages with many parser-blocking scripts would otherwise have their remaining input copied and
+    //               rescanned once per script. Everything past the input inserted since the last scan has already been
+    //               scanned, so only the newly inserted input in front of it is scanned here.
+    m_scanned_suffix_length = min(m_scanned_suffix_length, main_tokenizer.input_length());
+    if (unconsumed_input.size() <= m_scanned_suffix_length)
+        return;
+
+    auto unscanned_input = unconsumed_input.slice(0, unconsumed_input.size() - m_scanned_suffix_length);
+    m_scanned_suffix_length = unconsumed_input.size();
+    m_template_depth = 0;
+
+    // NOTE: The spec lets the speculative parser run in parallel with the main thread. We run it synchronously here,
+    //       since the main parser is about to spin the event loop waiting for the script anyway, and all the input we
+    //       have received so far is already available.
+    HTMLTokenizer tokenizer { unscanned_input };
+
+    while (m_active) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+
+        if (token->is_start_tag()) {
+            process_start_tag(tokenizer, *token);
+            continue;
+        }
+
+        if (token->is_end_tag() && token->tag_name() == TagNames::template_ && m_template_depth > 0)
+            --m_template_depth;
+    }
+
+    dbgln_if(HTML_PARSER_DEBUG, "SpeculativeHTMLParser: Scanned {} code points, {} speculative fetches in flight", unscanned_input.size(), m_fetch_controllers.size());
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#stop-the-speculative-html-parser
+void SpeculativeHTMLParser::stop()
+{
+    // 1. Let speculativeParser be parser's active speculative HTML parser.
+    // 2. If speculativeParser is null, then return.
+    if (!m_active)
+        return;
+
+    // 3. Throw away any pending content in speculativeParser's input stream, and discard any future content that would
+    //    have been added to it.
+    // 4. Set parser's active speculative HTML parser to null.
+    m_active = false;
+
+    // NOTE: Speculative fetches that are already in flight are intentionally not aborted, as their responses will
+    //       be used once the main parser reaches the corresponding elements.
+}
+
+Optional<URL::URL> SpeculativeHTMLParser::parse_url(StringView url) const
+{
+    if (m_base_url.has_value())
+        return DOMURL::parse(url, *m_base_url, m_document->encoding_or_default());
+    return m_document->encoding_parse_url(url);
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-fetch
+void SpeculativeHTMLParser::process_start_tag(HTMLTokenizer& tokenizer, HTMLToken const& token)
+{
+    auto const& tag_name = token.tag_name();
+
+    // The tree builder is not running, so the tokenizer state switches it would perform have to be done here, lest
+    // the contents of raw text elements be scanned as markup.
+    if (tag_name == TagNames::script) {
+        tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+    } else if (tag_name.is_one_of(TagNames::title, TagNames::textarea)) {
+        tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+    } else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes)
+        || (tag_name == TagNames::noscript && m_document->is_scripting_enabled())) {
+        tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+    } else if (tag_name == TagNames::plaintext) {
+        tokenizer.switch_to(HTMLTokenizer::State::PLAINTEXT);
+    } else if (tag_name == TagNames::template_) {
+        ++m_template_depth;
+        return;
+    }
+
+    // Resources inside template contents are inert, and must not be fetched.
+    if (m_template_depth > 0)
+        return;
+
+    auto crossorigin = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+
+    if (tag_name == TagNames::base) {
+        // The first base element with an href attribute determines the base URL for the rest of the document.
+        if (m_base_url.has_value())
+            return;
+        auto href = token.attribute(AttributeNames::href);
+        if (!href.has_value())
+            return;
+        if (auto url = m_document->encoding_parse_url(*href); url.has_value())
+            m_base_url = url.release_value();
+        return;
+    }
+
+    if (tag_name == TagNames::script) {
+        auto src = token.attribute(AttributeNames::src);
+        if (!src.has_value() || src->is_empty())
+            return;
+
+        // Only fetch scripts that would actually be executed: classic scripts with a JavaScript type, and module scripts.
+        auto type = token.attribute(AttributeNames::type).value_or({});
+        auto is_module = type.bytes_as_string_view().trim(Infra::ASCII_WHITESPACE).equals_ignoring_ascii_case("module"sv);
+        if (!is_module) {
+            if (token.has_attribute(AttributeNames::nomodule))
+                return;
+            if (!type.is_empty() && !MimeSniff::is_javascript_mime_type_essence_match(type.bytes_as_string_view().trim(Infra::ASCII_WHITESPACE)))
+                return;
+        }
+
+        auto url = parse_url(*src);
+        if (!url.has_value())
+            return;
+
+        // Module scripts are always fetched in CORS mode, with credentials for same-origin requests by default.
+        if (is_module && crossorigin == CORSSettingAttribute::NoCORS)
+            crossorigin = CORSSettingAttribute::Anonymous;
+
+        speculative_fetch(*url, Fetch::Infrastructure::Request::Destination::Script, crossorigin, token);
+        return;
+    }
+
+    if (tag_name == TagNames::link) {
+        auto href = token.attribute(AttributeNames::href);
+        if (!href.has_value() || href->is_empty())
+            return;
+
+        auto rel = token.attribute(AttributeNames::rel).value_or({});
+        bool is_stylesheet = false;
+        bool is_alternate = false;
+        bool is_preload = false;
+        bool is_modulepreload = false;
+        for (auto keyword : rel.bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace)) {
+            if (keyword.equals_ignoring_ascii_case("stylesheet"sv))
+                is_stylesheet = true;
+            else if (keyword.equals_ignoring_ascii_case("alternate"sv))
+                is_alternate = true;
+            else if (keyword.equals_ignoring_ascii_case("preload"sv))
+                is_preload = true;
+            else if (keyword.equals_ignoring_ascii_case("modulepreload"sv))
+                is_modulepreload = true;
+        }
+
+        auto url = parse_url(*href);
+        if (!url.has_value())
+            return;
+
+        if (is_stylesheet && !is_alternate && !token.has_attribute(AttributeNames::disabled)) {
+            speculative_fetch(*url, Fetch::Infrastructure::Request::Destination::Style, crossorigin, token);
+            return;
+        }
+
+        if (is_modulepreload) {
+            speculative_fetch(*url, Fetch::Infrastructure::Request::Destination::Script, crossorigin == CORSSettingAttribute::NoCORS ? CORSSettingAttribute::Anonymous : crossorigin, token);
+            return;
+        }
+
+        if (is_preload) {
+            // https://html.spec.whatwg.org/multipage/links.html#translate-a-preload-destination
+            // NOTE: Only the destinations whose responses end up being reused are fetched speculatively.
+            auto as = token.attribute(AttributeNames::as).value_or({}).to_ascii_lowercase();
+            if (as == "script"sv) {
+                speculative_fetch(*url, Fetch::Infrastructure::Request::Destination::Script, crossorigin, token);
+            } else if (as == "style"sv) {
+                speculative_fetch(*url, Fetch::Infrastructure::Request::Destination::Style, crossorigin, token);
+            } else if (as == "font"sv) {
+                // Fonts are always fetched in CORS mode.
+                speculative_fetch(*url, Fetch::Infrastructure::Request::Destination::Font, crossorigin == CORSSettingAttribute::NoCORS ? CORSSettingAttribute::Anonymous : crossorigin, token);
+            } else if (as == "image"sv) {
+                speculative_fetch(*url, Fetch::Infrastructure::Request::Destination::Image, crossorigin, token);
+            }
+        }
+        return;
+    }
+
+    if (tag_name == TagNames::img) {
+        speculative_fetch_image(token);
+        return;
+    }
+}
+
+void SpeculativeHTMLParser::speculative_fetch(URL::URL const& url, Fetch::Infrastructure::Request::Destination destination, CORSSettingAttribute crossorigin, HTMLToken const& token)
+{
+    if (!url.scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    if (m_fetched_urls.set(url) != AK::HashSetResult::InsertedNewEntry)
+        return;
+
+    auto& realm = m_document->realm();
+    auto& vm = realm.vm();
+
+    auto request = create_potential_CORS_request(vm, url, destination, crossorigin);
+    request->set_client(&m_document->relevant_settings_object());
+    request->set_initiator_type(destination == Fetch::Infrastructure::Request::Destination::Style
+            ? Fetch::Infrastructure::Request::InitiatorType::CSS
+            : Fetch::Infrastructure::Request::InitiatorType::Other);
+    request->set_referrer_policy(ReferrerPolicy::from_string(token.attribute(AttributeNames::referrerpolicy).value_or({})).value_or(ReferrerPolicy::ReferrerPolicy::EmptyString));
+    if (auto integrity = token.attribute(AttributeNames::integrity); integrity.has_value())
+        request->set_integrity_metadata(integrity.release_value());
+
+    dbgln_if(HTML_PARSER_DEBUG, "SpeculativeHTMLParser: Speculatively fetching {}", url);
+
+    // NOTE: The response body must be consumed in full for it to be stored in the HTTP cache, but we have no use for it
+    //       ourselves. The real fetch performed once the main parser reaches the element will be served from the cache.
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+    fetch_algorithms_input.process_response_consume_body = [weak_this = GC::Weak { *this }, url](GC::Ref<Fetch::Infrastructure::Response>, Fetch::Infrastructure::FetchAlgorithms::BodyBytes) {
+        if (weak_this)
+            weak_this->m_fetch_controllers.remove(url);
+    };
+
+    auto fetch_controller = Fetch::Fetching::fetch(realm, request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input)));
+    m_fetch_controllers.set(url, fetch_controller);
+}
+
+void SpeculativeHTMLParser::speculative_fetch_image(HTMLToken const& token)
+{
+    // Lazily loaded images are not fetched until they approach the viewport, so fetching them here would be wasteful.
+    if (auto loading = token.attribute(AttributeNames::loading); loading.has_value() && loading->equals_ignoring_ascii_case("lazy"sv))
+        return;
+
+    auto src = token.attribute(AttributeNames::src).value_or({});
+    auto srcset = token.attribute(AttributeNames::srcset).value_or({});
+
+    // Select an image source without the element. Width descriptors depend on the sizes attribute and layout, so
+    // only sources with pixel density descriptors (or none) are considered; anything else is left to the real element.
+    SourceSet source_set;
+    if (!srcset.is_empty())
+        source_set = parse_a_srcset_attribute(srcset);
+    if (!src.is_empty())
+        source_set.m_sources.append({ .url = src, .descriptor = Empty {} });
+
+    auto device_pixel_ratio = m_document->page().client().device_pixel_ratio();
+
+    Optional<String> selected_url;
+    Optional<double> selected_density;
+    for (auto const& source : source_set.m_sources) {
+        if (source.descriptor.has<ImageSource::WidthDescriptorValue>())
+            return;
+
+        auto density = source.descriptor.has<ImageSource::PixelDensityDescriptorValue>()
+            ? source.descriptor.get<ImageSource::PixelDensityDescriptorValue>().value
+            : 1.0;
+
+        // Prefer the smallest density that is at least the device pixel ratio, or the largest one otherwise.
+        bool is_better = !selected_density.has_value()
+            || (*selected_density < device_pixel_ratio && density > *selected_density)
+            || (density >= device_pixel_ratio && density < *selected_density);
+        if (is_better) {
+            selected_density = density;
+            selected_url = source.url;
+        }
+    }
+
+    if (!selected_url.has_value())
+        return;
+
+    auto url = parse_url(*selected_url);
+    if (!url.has_value() || !url->scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    if (m_fetched_urls.set(*url) != AK::HashSetResult::InsertedNewEntry)
+        return;
+
+    auto& realm = m_document->realm();
+
+    // Images are shared between elements by URL through the document's shared resource requests, so the <img> element
+    // created later will attach itself to the request we start here instead of fetching the image again.
+    auto shared_resource_request = SharedResourceRequest::get_or_create(realm, m_document->page(), *url);
+    if (!shared_resource_request->needs_fetching())
+        return;
+
+    m_image_requests.set(*url, shared_resource_request);
+    auto remove_image_request = [weak_this = GC::Weak { *this }, url = *url] {
+        if (weak_this)
+            weak_this->m_image_requests.remove(url);
+    };
+    shared_resource_request->add_callbacks(remove_image_request, remove_image_request);
+
+    dbgln_if(HTML_PARSER_DEBUG, "SpeculativeHTMLParser: Speculatively fetching image {}", *url);
+
+    auto request = create_potential_CORS_request(realm.vm(), *url, Fetch::Infrastructure::Request::Destination::Image, cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin)));
+    request->set_client(&m_document->relevant_settings_object());
+    if (!srcset.is_empty())
+        request->set_initiator(Fetch::Infrastructure::Request::Initiator::ImageSet);
+    request->set_referrer_policy(ReferrerPolicy::from_string(token.attribute(AttributeNames::referrerpolicy).value_or({})).value_or(ReferrerPolicy::ReferrerPolicy::EmptyString));
+
+    shared_resource_request->fetch_resource(realm, request);
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/Vector.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HTML/CORSSettingAttribute.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-html-parsing
+// While the main HTML parser is blocked on a parser-blocking script, the speculative HTML parser tokenizes the input
+// that has not been consumed yet and issues speculative fetches for the resources it finds. The fetched responses
+// end up in the HTTP cache (or, for images, in the document's shared resource requests), where the real elements
+// pick them up once the main parser reaches them.
+class SpeculativeHTMLParser final : public JS::Cell {
+    GC_CELL(SpeculativeHTMLParser, JS::Cell);
+    GC_DECLARE_ALLOCATOR(SpeculativeHTMLParser);
+
+public:
+    static GC::Ref<SpeculativeHTMLParser> create(DOM::Document&);
+
+    virtual ~SpeculativeHTMLParser() override;
+
+    // https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+    void start(HTMLTokenizer const&);
+
+    // https://html.spec.whatwg.org/multipage/parsing.html#stop-the-speculative-html-parser
+    void stop();
+
+    bool is_active() const { return m_active; }
+
+private:
+    explicit SpeculativeHTMLParser(DOM::Document&);
+
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    void process_start_tag(HTMLTokenizer&, HTMLToken const&);
+
+    Optional<URL::URL> parse_url(StringView) const;
+
+    void speculative_fetch(URL::URL const&, Fetch::Infrastructure::Request::Destination, CORSSettingAttribute, HTMLToken const&);
+    void speculative_fetch_image(HTMLToken const&);
+
+    GC::Ref<DOM::Document> m_document;
+
+    // The base URL established by the first <base href> seen by the speculative parser, if the document itself does
+    // not have one yet.
+    Optional<URL::URL> m_base_url;
+
+    // URLs that have already been speculatively fetched by this parser, so that rescanning the input after every
+    // parser-blocking script does not issue duplicate fetches.
+    HashTable<URL::URL> m_fetched_urls;
+
+    // Number of code points at the end of the main tokenizer's input that have already been scanned. Input is only
+    // ever inserted at the insertion point, which is where the main parser stopped when it was last blocked, so the
+    // scanned input stays a suffix of the main tokenizer's input and only what precedes it needs to be scanned.
+    size_t m_scanned_suffix_length { 0 };
+
+    // Speculative fetches that are still in flight, keyed by URL. Entries are removed once the body has been consumed.
+    HashMap<URL::URL, GC::Ref<Fetch::Infrastructure::FetchController>> m_fetch_controllers;
+
+    // Keeps speculatively fetched images alive while they are being fetched. Entries are removed once the fetch has
+    // finished or failed, after which the response is served from the HTTP cache.
+    HashMap<URL::URL, GC::Ref<SharedResourceRequest>> m_image_requests;
+
+    size_t m_template_depth { 0 };
+    bool m_active { false };
+};
+
+}
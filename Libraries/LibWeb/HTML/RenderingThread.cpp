@@ -9,6 +9,7 @@
 #include <LibThreading/Thread.h>
 #include <LibWeb/HTML/RenderingThread.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
+#include <LibWeb/Painting/CompositorAnimation.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
 
 namespace Web::HTML {
@@ -31,6 +32,7 @@ struct BackingStoreState {
 struct UpdateDisplayListCommand {
     NonnullRefPtr<Painting::DisplayList> display_list;
     Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot;
+    Vector<NonnullRefPtr<Painting::CompositorAnimation const>> animations;
 };
 
 struct UpdateBackingStoresCommand {
@@ -40,12 +42,17 @@ struct UpdateBackingStoresCommand {
     i32 back_bitmap_id;
 };
 
+struct ScrollCommand {
+    size_t scroll_frame_id;
+    CSSPixelPoint own_offset;
+};
+
 struct ScreenshotCommand {
     NonnullRefPtr<Gfx::PaintingSurface> target_surface;
     Function<void()> callback;
 };
 
-using CompositorCommand = Variant<UpdateDisplayListCommand, UpdateBackingStoresCommand, ScreenshotCommand>;
+using CompositorCommand = Variant<UpdateDisplayListCommand, UpdateBackingStoresCommand, ScrollCommand, ScreenshotCommand>;
 
 class RenderingThread::ThreadData final : public AtomicRefCounted<ThreadData> {
 public:
@@ -93,6 +100,13 @@ public:
             {
                 Threading::MutexLocker const locker { m_mutex };
                 while (m_command_queue.is_empty() && !m_needs_present && !m_exit) {
+                    // The animations of the cached display list are advanced by this thread alone, so it has to
+                    // present their frames without waiting for the main thread to ask for them.
+                    if (has_animations_to_present()) {
+                        if (!m_command_ready.wait_for(ANIMATION_FRAME_INTERVAL))
+                            m_needs_present = true;
+                        continue;
+                    }
                     m_command_ready.wait();
                 }
                 if (m_exit)
@@ -114,6 +128,7 @@ public:
                     [this](UpdateDisplayListCommand& cmd) {
                         m_cached_display_list = move(cmd.display_list);
                         m_cached_scroll_state_snapshot = move(cmd.scroll_state_snapshot);
+                        m_cached_animations = move(cmd.animations);
                     },
                     [this](UpdateBackingStoresCommand& cmd) {
                         m_backing_stores.front_store = move(cmd.front_store);
@@ -121,10 +136,23 @@ public:
                         m_backing_stores.front_bitmap_id = cmd.front_bitmap_id;
                         m_backing_stores.back_bitmap_id = cmd.back_bitmap_id;
                     },
+                    [this](ScrollCommand& cmd) {
+                        if (!m_cached_display_list)
+                            return;
+                        // NB: Only the scroll state of the top-level display list is updated, nested navigables are
+                        //     always scrolled on the main thread.
+                        auto scroll_state_snapshot = m_cached_scroll_state_snapshot.get(*m_cached_display_list);
+                        if (!scroll_state_snapshot.has_value())
+                            return;
+                        scroll_state_snapshot->set_own_offset_for_frame_with_id(cmd.scroll_frame_id, cmd.own_offset);
+
+                        Threading::MutexLocker const locker { m_mutex };
+                        m_needs_present = true;
+                    },
                     [this](ScreenshotCommand& cmd) {
                         if (!m_cached_display_list)
                             return;
-                        m_skia_player->execute(*m_cached_display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *cmd.target_surface);
+                        m_skia_player->execute(*m_cached_display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *cmd.target_surface, sample_animations());
                         if (cmd.callback) {
                             invoke_on_main_thread([callback = move(cmd.callback)]() mutable {
                                 callback();
@@ -162,9 +190,10 @@ public:
                 }
 
                 if (m_cached_display_list && m_backing_stores.is_valid()) {
-                    m_skia_player->execute(*m_cached_display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *m_backing_stores.back_store);
+                    m_skia_player->execute(*m_cached_display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *m_backing_stores.back_store, sample_animations());
                     i32 rendered_bitmap_id = m_backing_stores.back_bitmap_id;
                     m_backing_stores.swap();
+                    m_has_presented = true;
 
                     m_queued_rasterization_tasks++;
 
@@ -177,6 +206,24 @@ public:
     }
 
 private:
+    static constexpr AK::Duration ANIMATION_FRAME_INTERVAL = AK::Duration::from_microseconds(1'000'000 / 60);
+
+    bool has_animations_to_present() const
+    {
+        return !m_cached_animations.is_empty() && m_cached_display_list && m_backing_stores.is_valid() && m_has_presented;
+    }
+
+    Painting::AnimatedVisualContextValues sample_animations() const
+    {
+        Painting::AnimatedVisualContextValues values;
+        if (m_cached_animations.is_empty())
+            return values;
+        auto now = MonotonicTime::now();
+        for (auto const& animation : m_cached_animations)
+            values.set(&animation->target(), animation->sample(now));
+        return values;
+    }
+
     template<typename Invokee>
     void invoke_on_main_thread(Invokee invokee)
     {
@@ -199,7 +246,9 @@ private:
     OwnPtr<Painting::DisplayListPlayerSkia> m_skia_player;
     RefPtr<Painting::DisplayList> m_cached_display_list;
     Painting::ScrollStateSnapshotByDisplayList m_cached_scroll_state_snapshot;
+    Vector<NonnullRefPtr<Painting::CompositorAnimation const>> m_cached_animations;
     BackingStoreState m_backing_stores;
+    bool m_has_presented { false };
 
     Atomic<i32> m_queued_rasterization_tasks { 0 };
     mutable Threading::ConditionVariable m_ready_to_paint { m_mutex };
@@ -252,9 +301,9 @@ void RenderingThread::set_skia_player(OwnPtr<Painting::DisplayListPlayerSkia>&&
     m_thread_data->set_skia_player(move(player));
 }
 
-void RenderingThread::update_display_list(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshotByDisplayList&& scroll_state_snapshot)
+void RenderingThread::update_display_list(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshotByDisplayList&& scroll_state_snapshot, Vector<NonnullRefPtr<Painting::CompositorAnimation const>> animations)
 {
-    m_thread_data->enqueue_command(UpdateDisplayListCommand { move(display_list), move(scroll_state_snapshot) });
+    m_thread_data->enqueue_command(UpdateDisplayListCommand { move(display_list), move(scroll_state_snapshot), move(animations) });
 }
 
 void RenderingThread::update_backing_stores(RefPtr<Gfx::PaintingSurface> front, RefPtr<Gfx::PaintingSurface> back, i32 front_id, i32 back_id)
@@ -267,6 +316,11 @@ void RenderingThread::present_frame(Gfx::IntRect viewport_rect)
     m_thread_data->set_needs_present(viewport_rect);
 }
 
+void RenderingThread::scroll(size_t scroll_frame_id, CSSPixelPoint own_offset)
+{
+    m_thread_data->enqueue_command(ScrollCommand { scroll_frame_id, own_offset });
+}
+
 void RenderingThread::request_screenshot(NonnullRefPtr<Gfx::PaintingSurface> target_surface, Function<void()>&& callback)
 {
     m_thread_data->enqueue_command(ScreenshotCommand { move(target_surface), move(callback) });
@@ -49,6 +49,10 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
     // FIXME: 9. Record classic script creation time given script and sourceURLForWindowScripts .
 
     // 10. Let result be ParseScript(source, realm, script).
+    // FIXME: Parse scripts that arrive over the network on a background thread as soon as their body is complete, and
+    //        only allocate the Script on the main thread. This needs the parser to stop interning identifiers into the
+    //        process-wide, unlocked Utf16FlyString table, and strings with non-atomic reference counts to no longer be
+    //        shared between the two threads.
     auto parse_timer = Core::ElapsedTimer::start_new();
     auto result = JS::Script::parse(source, realm, script->filename(), script, source_line_number);
     dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Parsed {} in {}ms", script->filename(), parse_timer.elapsed_milliseconds());
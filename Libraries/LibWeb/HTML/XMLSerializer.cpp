@@ -12,7 +12,6 @@
 #include <LibWeb/DOM/DocumentFragment.h>
 #include <LibWeb/DOM/DocumentType.h>
 #include <LibWeb/DOM/Element.h>
-#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/DOM/ProcessingInstruction.h>
 #include <LibWeb/DOM/Text.h>
@@ -244,9 +243,8 @@ static Optional<FlyString> record_namespace_information(DOM::Element const& elem
     Optional<FlyString> default_namespace_attribute_value;
 
     // 2. Main: For each attribute attr in element's attributes, in the order they are specified in the element's attribute list:
-    for (size_t attribute_index = 0; attribute_index < element.attributes()->length(); ++attribute_index) {
-        auto const* attribute = element.attributes()->item(attribute_index);
-        VERIFY(attribute);
+    for (size_t attribute_index = 0; attribute_index < element.attribute_list().size(); ++attribute_index) {
+        auto const* attribute = &element.attribute_list().at(attribute_index);
 
         // 1. Let attribute namespace be the value of attr's namespaceURI value.
         auto const& attribute_namespace = attribute->namespace_uri();
@@ -341,9 +339,8 @@ static WebIDL::ExceptionOr<String> serialize_element_attributes(DOM::Element con
     Vector<LocalNameSetEntry> local_name_set;
 
     // 3. Loop: For each attribute attr in element's attributes, in the order they are specified in the element's attribute list:
-    for (size_t attribute_index = 0; attribute_index < element.attributes()->length(); ++attribute_index) {
-        auto const* attribute = element.attributes()->item(attribute_index);
-        VERIFY(attribute);
+    for (size_t attribute_index = 0; attribute_index < element.attribute_list().size(); ++attribute_index) {
+        auto const* attribute = &element.attribute_list().at(attribute_index);
 
         // 1. If the require well-formed flag is set (its value is true), and the localname set contains a tuple whose values match those of a new tuple consisting of attr's namespaceURI attribute and localName attribute,
         //      then throw an exception; the serialization of this attr would fail to produce a well-formed element serialization.
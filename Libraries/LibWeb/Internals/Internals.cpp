@@ -326,6 +326,17 @@ void Internals::wheel(double x, double y, double delta_x, double delta_y)
     page.handle_mousewheel(position, position, 0, 0, 0, delta_x, delta_y);
 }
 
+// Delivers a wheel event the way WebContent does for events received over IPC, which first tries to scroll the
+// viewport on the rendering thread.
+void Internals::asynchronous_wheel(double x, double y, double delta_x, double delta_y)
+{
+    auto& page = this->page();
+
+    auto position = page.css_to_device_point({ x, y });
+    auto asynchronous_scroll_delta = page.handle_asynchronous_mousewheel(position, 0, delta_x, delta_y);
+    page.handle_mousewheel(position, position, 0, 0, 0, delta_x, delta_y, asynchronous_scroll_delta);
+}
+
 void Internals::pinch(double x, double y, double scale_delta)
 {
     auto& page = this->page();
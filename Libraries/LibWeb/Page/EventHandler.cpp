@@ -552,7 +552,7 @@ GC::Ptr<Painting::PaintableBox const> EventHandler::paint_root() const
     return m_navigable->active_document()->paintable_box();
 }
 
-EventResult EventHandler::handle_mousewheel(CSSPixelPoint visual_viewport_position, CSSPixelPoint screen_position, u32 button, u32 buttons, u32 modifiers, int wheel_delta_x, int wheel_delta_y)
+EventResult EventHandler::handle_mousewheel(CSSPixelPoint visual_viewport_position, CSSPixelPoint screen_position, u32 button, u32 buttons, u32 modifiers, int wheel_delta_x, int wheel_delta_y, Optional<CSSPixelPoint> asynchronous_scroll_delta)
 {
     if (should_ignore_device_input_event())
         return EventResult::Dropped;
@@ -575,11 +575,18 @@ EventResult EventHandler::handle_mousewheel(CSSPixelPoint visual_viewport_positi
 
     auto handled_event = EventResult::Dropped;
 
+    // NB: If the rendering thread has already scrolled the viewport for this event, all that's left to do is to catch up
+    //     with the scroll offset it applied and to dispatch the wheel event, which could not have canceled the scroll.
+    if (asynchronous_scroll_delta.has_value()) {
+        m_navigable->scroll_viewport_by_delta(*asynchronous_scroll_delta);
+        handled_event = EventResult::Handled;
+    }
+
     GC::Ptr<Painting::Paintable> paintable;
     if (auto result = target_for_mouse_position(visual_viewport_position); result.has_value())
         paintable = result->paintable;
 
-    if (paintable) {
+    if (paintable && !asynchronous_scroll_delta.has_value()) {
         Painting::Paintable* containing_block = paintable;
         while (containing_block) {
             auto handled_scroll_event = containing_block->handle_mousewheel({}, visual_viewport_position, buttons, modifiers, wheel_delta_x, wheel_delta_y);
@@ -591,11 +598,13 @@ EventResult EventHandler::handle_mousewheel(CSSPixelPoint visual_viewport_positi
 
         if (paintable->handle_mousewheel({}, visual_viewport_position, buttons, modifiers, wheel_delta_x, wheel_delta_y))
             return EventResult::Handled;
+    }
 
+    if (paintable) {
         auto node = dom_node_for_event_dispatch(*paintable);
 
         if (node) {
-            if (auto* navigable_container = as_if<HTML::NavigableContainer>(*node)) {
+            if (auto* navigable_container = as_if<HTML::NavigableContainer>(*node); navigable_container && !asynchronous_scroll_delta.has_value()) {
                 auto position = compute_position_in_nested_navigable(as<Painting::NavigableContainerViewportPaintable>(*paintable), visual_viewport_position);
                 auto result = navigable_container->content_navigable()->event_handler().handle_mousewheel(position, screen_position, button, buttons, modifiers, wheel_delta_x, wheel_delta_y);
                 if (result == EventResult::Handled)
@@ -605,13 +614,14 @@ EventResult EventHandler::handle_mousewheel(CSSPixelPoint visual_viewport_positi
             // NB: Search for the first parent of the hit target that's an element.
             GC::Ptr<Layout::Node> layout_node;
             if (!parent_element_for_event_dispatch(*paintable, node, layout_node))
-                return EventResult::Dropped;
+                return handled_event;
 
             auto page_offset = compute_mouse_event_page_offset(viewport_position);
             auto const& offset_paintable = layout_node->first_paintable() ? layout_node->first_paintable() : paintable.ptr();
             auto scroll_offset = document->navigable()->viewport_scroll_offset();
             auto offset = compute_mouse_event_offset(visual_viewport_position.translated(scroll_offset), *offset_paintable);
-            if (node->dispatch_event(UIEvents::WheelEvent::create_from_platform_event(node->realm(), m_navigable->active_window_proxy(), UIEvents::EventNames::wheel, screen_position, page_offset, viewport_position, offset, wheel_delta_x, wheel_delta_y, button, buttons, modifiers).release_value_but_fixme_should_propagate_errors())) {
+            if (node->dispatch_event(UIEvents::WheelEvent::create_from_platform_event(node->realm(), m_navigable->active_window_proxy(), UIEvents::EventNames::wheel, screen_position, page_offset, viewport_position, offset, wheel_delta_x, wheel_delta_y, button, buttons, modifiers).release_value_but_fixme_should_propagate_errors())
+                && !asynchronous_scroll_delta.has_value()) {
                 m_navigable->scroll_viewport_by_delta({ wheel_delta_x, wheel_delta_y });
             }
 
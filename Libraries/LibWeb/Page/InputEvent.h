@@ -97,6 +97,9 @@ struct QueuedInputEvent {
     u64 page_id { 0 };
     InputEvent event;
     size_t coalesced_event_count { 0 };
+
+    // The part of a wheel event's delta that has already been scrolled on the rendering thread.
+    Optional<CSSPixelPoint> asynchronous_scroll_delta;
 };
 
 }
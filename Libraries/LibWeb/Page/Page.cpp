@@ -254,9 +254,15 @@ EventResult Page::handle_mouseleave()
     return top_level_traversable()->event_handler().handle_mouseleave();
 }
 
-EventResult Page::handle_mousewheel(DevicePixelPoint position, DevicePixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers, DevicePixels wheel_delta_x, DevicePixels wheel_delta_y)
+EventResult Page::handle_mousewheel(DevicePixelPoint position, DevicePixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers, DevicePixels wheel_delta_x, DevicePixels wheel_delta_y, Optional<CSSPixelPoint> asynchronous_scroll_delta)
 {
-    return top_level_traversable()->event_handler().handle_mousewheel(device_to_css_point(position), device_to_css_point(screen_position), button, buttons, modifiers, wheel_delta_x.value(), wheel_delta_y.value());
+    return top_level_traversable()->event_handler().handle_mousewheel(device_to_css_point(position), device_to_css_point(screen_position), button, buttons, modifiers, wheel_delta_x.value(), wheel_delta_y.value(), asynchronous_scroll_delta);
+}
+
+Optional<CSSPixelPoint> Page::handle_asynchronous_mousewheel(DevicePixelPoint position, unsigned modifiers, DevicePixels wheel_delta_x, DevicePixels wheel_delta_y)
+{
+    // NB: Like the main thread, we use the wheel deltas as CSS pixels.
+    return top_level_traversable()->scroll_viewport_asynchronously(device_to_css_point(position), modifiers, { wheel_delta_x.value(), wheel_delta_y.value() });
 }
 
 EventResult Page::handle_doubleclick(DevicePixelPoint position, DevicePixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers)
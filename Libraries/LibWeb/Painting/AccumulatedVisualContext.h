@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/AtomicRefCounted.h>
+#include <AK/HashMap.h>
 #include <AK/Variant.h>
 #include <LibGfx/CompositingAndBlendingOperator.h>
 #include <LibGfx/Matrix4x4.h>
@@ -110,4 +111,9 @@ private:
     size_t m_id;
 };
 
+// Values that replace the opacity of an effects node or the matrix of a transform node while playing back a display
+// list, so that animations of those can advance without recording the display list again.
+using AnimatedVisualContextValue = Variant<float, Gfx::FloatMatrix4x4>;
+using AnimatedVisualContextValues = HashMap<AccumulatedVisualContext const*, AnimatedVisualContextValue>;
+
 }
@@ -0,0 +1,464 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/Animations/Animation.h>
+#include <LibWeb/Animations/DocumentTimeline.h>
+#include <LibWeb/Animations/KeyframeEffect.h>
+#include <LibWeb/CSS/ComputedProperties.h>
+#include <LibWeb/CSS/StyleValues/PercentageStyleValue.h>
+#include <LibWeb/CSS/StyleValues/StyleValueList.h>
+#include <LibWeb/CSS/StyleValues/TransformationStyleValue.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/Painting/CompositorAnimation.h>
+#include <LibWeb/Painting/PaintableBox.h>
+#include <LibWeb/Painting/ViewportPaintable.h>
+
+namespace Web::Painting {
+
+NonnullRefPtr<CompositorAnimation> CompositorAnimation::create(NonnullRefPtr<AccumulatedVisualContext const> target, Timing timing, Vector<Keyframe> keyframes, Value underlying_value, Gfx::FloatMatrix4x4 transform_prefix)
+{
+    return adopt_ref(*new CompositorAnimation(move(target), move(timing), move(keyframes), move(underlying_value), transform_prefix));
+}
+
+CompositorAnimation::CompositorAnimation(NonnullRefPtr<AccumulatedVisualContext const> target, Timing timing, Vector<Keyframe> keyframes, Value underlying_value, Gfx::FloatMatrix4x4 transform_prefix)
+    : m_target(move(target))
+    , m_timing(move(timing))
+    , m_keyframes(move(keyframes))
+    , m_underlying_value(move(underlying_value))
+    , m_transform_prefix(transform_prefix)
+{
+    VERIFY(m_keyframes.size() >= 2);
+
+    // NB: The easing function is shared with the main thread through its serialization, which is not thread-safe to
+    //     copy around. We never serialize it here, so drop it.
+    m_timing.easing.visit([](auto& function) { function.stringified = {}; });
+}
+
+// NB: This follows the timing model of AnimationEffect, with the current time of the animation derived from the
+//     monotonic clock instead of the timeline of the document.
+Optional<double> CompositorAnimation::transformed_progress(MonotonicTime now) const
+{
+    auto const& timing = m_timing;
+
+    // https://www.w3.org/TR/web-animations-1/#the-current-time-of-an-animation
+    auto timeline_time = timing.timeline_time + static_cast<double>((now - timing.reference_time).to_microseconds()) / 1000.0;
+    auto local_time = (timeline_time - timing.start_time) * timing.playback_rate;
+
+    // https://www.w3.org/TR/web-animations-1/#active-duration
+    auto active_duration = (timing.iteration_duration == 0.0 || timing.iteration_count == 0.0) ? 0.0 : timing.iteration_duration * timing.iteration_count;
+
+    // https://www.w3.org/TR/web-animations-1/#end-time
+    auto end_time = max(timing.start_delay + active_duration + timing.end_delay, 0.0);
+
+    // https://www.w3.org/TR/web-animations-1/#animation-effect-phases-and-states
+    auto before_active_boundary_time = max(min(timing.start_delay, end_time), 0.0);
+    auto after_active_boundary_time = max(min(timing.start_delay + active_duration, end_time), 0.0);
+    auto animation_direction_is_backwards = timing.playback_rate < 0.0;
+    auto is_in_the_before_phase = local_time < before_active_boundary_time || (animation_direction_is_backwards && local_time == before_active_boundary_time);
+    auto is_in_the_after_phase = !is_in_the_before_phase && (local_time > after_active_boundary_time || (!animation_direction_is_backwards && local_time == after_active_boundary_time));
+    auto is_in_the_active_phase = !is_in_the_before_phase && !is_in_the_after_phase;
+
+    // https://www.w3.org/TR/web-animations-1/#calculating-the-active-time
+    Optional<double> active_time;
+    if (is_in_the_before_phase) {
+        if (timing.fill_mode == Bindings::FillMode::Backwards || timing.fill_mode == Bindings::FillMode::Both)
+            active_time = max(local_time - timing.start_delay, 0.0);
+    } else if (is_in_the_active_phase) {
+        active_time = local_time - timing.start_delay;
+    } else if (timing.fill_mode == Bindings::FillMode::Forwards || timing.fill_mode == Bindings::FillMode::Both) {
+        active_time = max(min(local_time - timing.start_delay, active_duration), 0.0);
+    }
+    if (!active_time.has_value())
+        return {};
+
+    // https://www.w3.org/TR/web-animations-1/#overall-progress
+    double overall_progress;
+    if (timing.iteration_duration == 0.0)
+        overall_progress = is_in_the_before_phase ? 0.0 : timing.iteration_count;
+    else
+        overall_progress = *active_time / timing.iteration_duration;
+    overall_progress += timing.iteration_start;
+
+    // https://www.w3.org/TR/web-animations-1/#simple-iteration-progress
+    auto simple_iteration_progress = isinf(overall_progress) ? fmod(timing.iteration_start, 1.0) : fmod(overall_progress, 1.0);
+    if (simple_iteration_progress == 0.0 && (is_in_the_active_phase || is_in_the_after_phase) && *active_time == active_duration && timing.iteration_count != 0.0)
+        simple_iteration_progress = 1.0;
+
+    // https://www.w3.org/TR/web-animations-1/#current-iteration
+    double current_iteration;
+    if (is_in_the_after_phase && isinf(timing.iteration_count))
+        current_iteration = timing.iteration_count;
+    else if (simple_iteration_progress == 1.0)
+        current_iteration = floor(overall_progress) - 1.0;
+    else
+        current_iteration = floor(overall_progress);
+
+    // https://www.w3.org/TR/web-animations-1/#directed-progress
+    auto going_forwards = [&] {
+        switch (timing.playback_direction) {
+        case Bindings::PlaybackDirection::Normal:
+            return true;
+        case Bindings::PlaybackDirection::Reverse:
+            return false;
+        case Bindings::PlaybackDirection::Alternate:
+        case Bindings::PlaybackDirection::AlternateReverse: {
+            auto d = current_iteration;
+            if (timing.playback_direction == Bindings::PlaybackDirection::AlternateReverse)
+                d += 1.0;
+            return isinf(d) || fmod(d, 2.0) == 0.0;
+        }
+        }
+        VERIFY_NOT_REACHED();
+    }();
+    auto directed_progress = going_forwards ? simple_iteration_progress : 1.0 - simple_iteration_progress;
+
+    // https://www.w3.org/TR/web-animations-1/#transformed-progress
+    auto before_flag = (is_in_the_before_phase && going_forwards) || (is_in_the_after_phase && !going_forwards);
+    return timing.easing.evaluate_at(directed_progress, before_flag);
+}
+
+static CompositorAnimation::Value interpolate_value(CompositorAnimation::Value const& from, CompositorAnimation::Value const& to, double delta)
+{
+    auto interpolate_number = [delta](float from, float to) {
+        return static_cast<float>(from + (to - from) * delta);
+    };
+
+    if (from.has<float>())
+        return interpolate_number(from.get<float>(), to.get<float>());
+
+    // NB: Keyframe transform lists have been normalized to the same functions, so we can interpolate their arguments.
+    auto const& from_functions = from.get<CompositorAnimation::TransformFunctionList>();
+    auto const& to_functions = to.get<CompositorAnimation::TransformFunctionList>();
+    CompositorAnimation::TransformFunctionList result;
+    result.ensure_capacity(from_functions.size());
+    for (size_t i = 0; i < from_functions.size(); ++i) {
+        CompositorAnimation::TransformFunction function { from_functions[i].function, {} };
+        for (size_t j = 0; j < from_functions[i].arguments.size(); ++j)
+            function.arguments.append(interpolate_number(from_functions[i].arguments[j], to_functions[i].arguments[j]));
+        result.unchecked_append(move(function));
+    }
+    return result;
+}
+
+AnimatedVisualContextValue CompositorAnimation::to_visual_context_value(Value const& value) const
+{
+    return value.visit(
+        [](float opacity) -> AnimatedVisualContextValue {
+            return clamp(opacity, 0.0f, 1.0f);
+        },
+        [this](TransformFunctionList const& functions) -> AnimatedVisualContextValue {
+            auto matrix = m_transform_prefix;
+            for (auto const& function : functions)
+                matrix = matrix * CSS::TransformationStyleValue::to_matrix(function.function, function.arguments);
+            return matrix;
+        });
+}
+
+AnimatedVisualContextValue CompositorAnimation::sample(MonotonicTime now) const
+{
+    auto progress = transformed_progress(now);
+    if (!progress.has_value())
+        return to_visual_context_value(m_underlying_value);
+
+    // NB: This picks the keyframes to interpolate between the same way StyleComputer::collect_animation_into() does.
+    size_t start_index = 0;
+    if (*progress > 0.0) {
+        while (start_index + 1 < m_keyframes.size() && m_keyframes[start_index + 1].offset <= *progress)
+            ++start_index;
+        if (start_index + 1 == m_keyframes.size())
+            --start_index;
+    }
+    auto const& start = m_keyframes[start_index];
+    auto const& end = m_keyframes[start_index + 1];
+
+    // NB: Keyframe offsets come from the unique keys of the keyframe set, but guard against an empty interval anyway so
+    //     that we never interpolate with NaN.
+    auto keyframe_interval = end.offset - start.offset;
+    auto progress_in_keyframe = keyframe_interval > 0.0 ? (*progress - start.offset) / keyframe_interval : 0.0;
+    return to_visual_context_value(interpolate_value(start.value, end.value, progress_in_keyframe));
+}
+
+static Optional<CompositorAnimation::TransformFunction> resolve_transform_function(CSS::StyleValue const& value, PaintableBox const& paintable_box)
+{
+    if (!value.is_transformation())
+        return {};
+    auto const& transformation = value.as_transformation();
+    auto arguments = transformation.resolve_arguments(paintable_box);
+    if (arguments.is_error())
+        return {};
+    CompositorAnimation::TransformFunction function { transformation.transform_function(), {} };
+    function.arguments.extend(arguments.value());
+    return function;
+}
+
+// https://drafts.csswg.org/css-transforms-2/#interpolation-of-transform-functions
+// NB: We only animate functions that interpolate numerically on the rendering thread. Like the style computer, we
+//     convert the two-dimensional ones to their primitives first, so that e.g. translateX() and translate() match.
+static Optional<CompositorAnimation::TransformFunction> to_interpolable_primitive(CompositorAnimation::TransformFunction function)
+{
+    auto& arguments = function.arguments;
+    if (arguments.is_empty())
+        return {};
+
+    switch (function.function) {
+    case CSS::TransformFunction::Translate:
+        return CompositorAnimation::TransformFunction { CSS::TransformFunction::Translate, { arguments[0], arguments.size() > 1 ? arguments[1] : 0.0f } };
+    case CSS::TransformFunction::TranslateX:
+        return CompositorAnimation::TransformFunction { CSS::TransformFunction::Translate, { arguments[0], 0.0f } };
+    case CSS::TransformFunction::TranslateY:
+        return CompositorAnimation::TransformFunction { CSS::TransformFunction::Translate, { 0.0f, arguments[0] } };
+    case CSS::TransformFunction::Scale:
+        return CompositorAnimation::TransformFunction { CSS::TransformFunction::Scale, { arguments[0], arguments.size() > 1 ? arguments[1] : arguments[0] } };
+    case CSS::TransformFunction::ScaleX:
+        return CompositorAnimation::TransformFunction { CSS::TransformFunction::Scale, { arguments[0], 1.0f } };
+    case CSS::TransformFunction::ScaleY:
+        return CompositorAnimation::TransformFunction { CSS::TransformFunction::Scale, { 1.0f, arguments[0] } };
+    case CSS::TransformFunction::Rotate:
+    case CSS::TransformFunction::Skew:
+    case CSS::TransformFunction::SkewX:
+    case CSS::TransformFunction::SkewY:
+        return function;
+    default:
+        return {};
+    }
+}
+
+// https://drafts.csswg.org/css-transforms-1/#identity-transform-function
+static CompositorAnimation::TransformFunction identity_transform_function(CompositorAnimation::TransformFunction const& function)
+{
+    auto identity_argument = function.function == CSS::TransformFunction::Scale ? 1.0f : 0.0f;
+    CompositorAnimation::TransformFunction identity { function.function, {} };
+    identity.arguments.resize(function.arguments.size());
+    identity.arguments.fill(identity_argument);
+    return identity;
+}
+
+static Optional<CompositorAnimation::TransformFunctionList> resolve_transform_function_list(CSS::StyleValue const& value, PaintableBox const& paintable_box)
+{
+    if (value.to_keyword() == CSS::Keyword::None)
+        return CompositorAnimation::TransformFunctionList {};
+
+    CompositorAnimation::TransformFunctionList functions;
+    auto append = [&](CSS::StyleValue const& function_value) {
+        auto function = resolve_transform_function(function_value, paintable_box);
+        if (!function.has_value())
+            return false;
+        functions.append(function.release_value());
+        return true;
+    };
+
+    if (value.is_value_list()) {
+        for (auto const& function_value : value.as_value_list().values()) {
+            if (!append(*function_value))
+                return {};
+        }
+        return functions;
+    }
+    if (!append(value))
+        return {};
+    return functions;
+}
+
+static Optional<CompositorAnimation::Value> resolve_value(CSS::PropertyID property_id, CSS::StyleValue const& value, PaintableBox const& paintable_box)
+{
+    if (property_id == CSS::PropertyID::Opacity) {
+        if (value.is_number())
+            return static_cast<float>(value.as_number().number());
+        if (value.is_percentage())
+            return static_cast<float>(value.as_percentage().percentage().as_fraction());
+        return {};
+    }
+
+    VERIFY(property_id == CSS::PropertyID::Transform);
+    auto functions = resolve_transform_function_list(value, paintable_box);
+    if (!functions.has_value())
+        return {};
+    return functions.release_value();
+}
+
+// https://drafts.csswg.org/css-transforms-1/#interpolation-of-transforms
+// Brings the transform lists of all keyframes to the same functions, by converting them to their primitives and
+// extending shorter lists with identity functions. Returns false if the lists can't be interpolated numerically.
+static bool normalize_transform_keyframes(Vector<CompositorAnimation::Keyframe>& keyframes)
+{
+    CompositorAnimation::TransformFunctionList const* longest_list = nullptr;
+    for (auto& keyframe : keyframes) {
+        for (auto& function : keyframe.value.get<CompositorAnimation::TransformFunctionList>()) {
+            auto primitive = to_interpolable_primitive(move(function));
+            if (!primitive.has_value())
+                return false;
+            function = primitive.release_value();
+        }
+        auto const& functions = keyframe.value.get<CompositorAnimation::TransformFunctionList>();
+        if (!longest_list || functions.size() > longest_list->size())
+            longest_list = &functions;
+    }
+
+    auto reference_list = *longest_list;
+    for (auto& keyframe : keyframes) {
+        auto& functions = keyframe.value.get<CompositorAnimation::TransformFunctionList>();
+        for (size_t i = 0; i < reference_list.size(); ++i) {
+            if (i >= functions.size()) {
+                functions.append(identity_transform_function(reference_list[i]));
+                continue;
+            }
+            if (functions[i].function != reference_list[i].function || functions[i].arguments.size() != reference_list[i].arguments.size())
+                return false;
+        }
+    }
+    return true;
+}
+
+static Optional<Gfx::FloatMatrix4x4> individual_transform_properties_matrix(PaintableBox const& paintable_box)
+{
+    auto const& computed_values = paintable_box.computed_values();
+    auto matrix = Gfx::FloatMatrix4x4::identity();
+    for (auto const& transformation : { computed_values.translate(), computed_values.rotate(), computed_values.scale() }) {
+        if (!transformation)
+            continue;
+        auto transformation_matrix = transformation->to_matrix(paintable_box);
+        if (transformation_matrix.is_error())
+            return {};
+        matrix = matrix * transformation_matrix.value();
+    }
+    return matrix;
+}
+
+static RefPtr<CompositorAnimation> create_for_effect(Animations::KeyframeEffect& effect, CSS::PropertyID property_id, PaintableBox const& paintable_box, NonnullRefPtr<AccumulatedVisualContext const> target)
+{
+    // Only running animations on a document timeline advance with the monotonic clock.
+    auto animation = effect.associated_animation();
+    if (!animation || animation->play_state() != Bindings::AnimationPlayState::Running || animation->pending() || animation->playback_rate() == 0.0)
+        return {};
+    auto timeline = animation->timeline();
+    if (!timeline || !is<Animations::DocumentTimeline>(*timeline))
+        return {};
+    auto timeline_time = timeline->current_time();
+    auto start_time = animation->start_time();
+    if (!timeline_time.has_value() || !start_time.has_value())
+        return {};
+    for (auto const& time : { *timeline_time, *start_time, effect.start_delay(), effect.end_delay(), effect.iteration_duration() }) {
+        if (time.type != Animations::TimeValue::Type::Milliseconds)
+            return {};
+    }
+
+    // If the effect animates anything else, the display list has to be recorded again on every frame anyway.
+    for (auto animated_property_id : effect.target_properties()) {
+        if (!first_is_one_of(animated_property_id, CSS::PropertyID::Opacity, CSS::PropertyID::Transform))
+            return {};
+    }
+    if (effect.composite() != Bindings::CompositeOperation::Replace)
+        return {};
+
+    // Content that isn't painted at the time the display list is recorded can't be brought back by the rendering
+    // thread.
+    if (paintable_box.has_non_invertible_css_transform() || paintable_box.computed_values().opacity() == 0.0f)
+        return {};
+
+    auto computed_properties = effect.target()->computed_properties();
+    if (!computed_properties)
+        return {};
+    auto underlying_value = resolve_value(property_id, computed_properties->property(property_id, CSS::ComputedProperties::WithAnimationsApplied::No), paintable_box);
+    if (!underlying_value.has_value())
+        return {};
+
+    auto const* key_frame_set = effect.key_frame_set();
+    if (!key_frame_set || key_frame_set->keyframes_by_key.size() < 2)
+        return {};
+
+    Vector<CompositorAnimation::Keyframe> keyframes;
+    for (auto it = key_frame_set->keyframes_by_key.begin(); it != key_frame_set->keyframes_by_key.end(); ++it) {
+        if (it->composite != Bindings::CompositeOperationOrAuto::Auto && it->composite != Bindings::CompositeOperationOrAuto::Replace)
+            return {};
+        auto keyframe_value = it->properties.get(property_id);
+        if (!keyframe_value.has_value())
+            return {};
+        auto value = keyframe_value->visit(
+            [&](Animations::KeyframeEffect::KeyFrameSet::UseInitial) -> Optional<CompositorAnimation::Value> {
+                return underlying_value;
+            },
+            [&](NonnullRefPtr<CSS::StyleValue const> const& style_value) -> Optional<CompositorAnimation::Value> {
+                return resolve_value(property_id, *style_value, paintable_box);
+            });
+        if (!value.has_value())
+            return {};
+        auto offset = static_cast<double>(it.key()) / (100.0 * Animations::KeyframeEffect::AnimationKeyFrameKeyScaleFactor);
+        keyframes.append({ offset, value.release_value() });
+    }
+
+    auto transform_prefix = Gfx::FloatMatrix4x4::identity();
+    if (property_id == CSS::PropertyID::Transform) {
+        if (!normalize_transform_keyframes(keyframes))
+            return {};
+        auto matrix = individual_transform_properties_matrix(paintable_box);
+        if (!matrix.has_value())
+            return {};
+        transform_prefix = matrix.release_value();
+    }
+
+    CompositorAnimation::Timing timing {
+        .reference_time = MonotonicTime::now(),
+        .timeline_time = timeline_time->value,
+        .start_time = start_time->value,
+        .playback_rate = animation->playback_rate(),
+        .start_delay = effect.start_delay().value,
+        .end_delay = effect.end_delay().value,
+        .iteration_duration = effect.iteration_duration().value,
+        .iteration_start = effect.iteration_start(),
+        .iteration_count = effect.iteration_count(),
+        .playback_direction = effect.playback_direction(),
+        .fill_mode = effect.fill_mode(),
+        .easing = effect.timing_function(),
+    };
+    return CompositorAnimation::create(move(target), move(timing), move(keyframes), underlying_value.release_value(), transform_prefix);
+}
+
+Vector<NonnullRefPtr<CompositorAnimation const>> CompositorAnimation::collect(ViewportPaintable const& viewport_paintable, u64 display_list_generation, Vector<GC::Ref<Animations::KeyframeEffect>>& effects)
+{
+    Vector<NonnullRefPtr<CompositorAnimation const>> animations;
+
+    for (auto const& contexts : viewport_paintable.animatable_visual_contexts()) {
+        auto const& element = as<DOM::Element>(*contexts.paintable_box->dom_node());
+
+        for (auto property_id : { CSS::PropertyID::Opacity, CSS::PropertyID::Transform }) {
+            auto const& target = property_id == CSS::PropertyID::Opacity ? contexts.effects : contexts.transform;
+            if (!target)
+                continue;
+
+            // The rendering thread doesn't composite animations with each other, so the property must be animated
+            // by a single effect.
+            GC::Ptr<Animations::KeyframeEffect> effect_for_property;
+            bool has_multiple_effects_for_property = false;
+            for (auto const& animation : element.associated_animations()) {
+                if (animation->is_idle())
+                    continue;
+                auto* effect = as_if<Animations::KeyframeEffect>(animation->effect().ptr());
+                if (!effect || effect->pseudo_element_type().has_value() || !effect->target_properties().contains(property_id))
+                    continue;
+                if (effect_for_property) {
+                    has_multiple_effects_for_property = true;
+                    break;
+                }
+                effect_for_property = effect;
+            }
+            if (!effect_for_property || has_multiple_effects_for_property)
+                continue;
+
+            auto animation = create_for_effect(*effect_for_property, property_id, *contexts.paintable_box, *target);
+            if (!animation)
+                continue;
+            effect_for_property->set_running_on_compositor(property_id, effect_for_property->compositor_animation_state(display_list_generation));
+            if (!effects.contains_slow(GC::Ref { *effect_for_property }))
+                effects.append(*effect_for_property);
+            animations.append(animation.release_nonnull());
+        }
+    }
+
+    return animations;
+}
+
+}
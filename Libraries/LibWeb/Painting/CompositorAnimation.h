@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/Time.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibGfx/Matrix4x4.h>
+#include <LibWeb/Bindings/AnimationEffectPrototype.h>
+#include <LibWeb/CSS/EasingFunction.h>
+#include <LibWeb/CSS/TransformFunctions.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Painting/AccumulatedVisualContext.h>
+
+namespace Web::Painting {
+
+// A copy of a running opacity or transform animation that the rendering thread samples by itself, so that the main
+// thread doesn't have to record a new display list every time the animated value changes. It only holds plain values
+// (the timing of the animation and its keyframes, resolved against the target box), which makes it safe to use from
+// the rendering thread while the main thread keeps mutating the DOM.
+class WEB_API CompositorAnimation final : public AtomicRefCounted<CompositorAnimation> {
+public:
+    // All times are in milliseconds.
+    struct Timing {
+        // The current time of the animation's timeline at a known monotonic time, used to advance the timeline on
+        // the rendering thread.
+        MonotonicTime reference_time;
+        double timeline_time { 0.0 };
+
+        double start_time { 0.0 };
+        double playback_rate { 1.0 };
+        double start_delay { 0.0 };
+        double end_delay { 0.0 };
+        double iteration_duration { 0.0 };
+        double iteration_start { 0.0 };
+        double iteration_count { 1.0 };
+        Bindings::PlaybackDirection playback_direction { Bindings::PlaybackDirection::Normal };
+        Bindings::FillMode fill_mode { Bindings::FillMode::Auto };
+        CSS::EasingFunction easing { CSS::EasingFunction::linear() };
+    };
+
+    // A transform function with its arguments resolved to CSS pixels, radians and numbers.
+    struct TransformFunction {
+        CSS::TransformFunction function;
+        Vector<float, 4> arguments;
+    };
+    using TransformFunctionList = Vector<TransformFunction>;
+    using Value = Variant<float, TransformFunctionList>;
+
+    struct Keyframe {
+        double offset { 0.0 };
+        Value value;
+    };
+
+    // Transform keyframes must all have the same list of functions, with the same number of arguments each.
+    // The transform prefix is the matrix of the individual transform properties (translate, rotate and scale), which
+    // apply before the transform property.
+    static NonnullRefPtr<CompositorAnimation> create(NonnullRefPtr<AccumulatedVisualContext const> target, Timing, Vector<Keyframe>, Value underlying_value, Gfx::FloatMatrix4x4 transform_prefix = Gfx::FloatMatrix4x4::identity());
+
+    // Returns copies of all animations on the page that the rendering thread can run by itself, and marks their
+    // effects as running on the compositor for the given display list generation. The effects are appended to
+    // `effects`, so that the caller can tell when the copies go stale.
+    static Vector<NonnullRefPtr<CompositorAnimation const>> collect(ViewportPaintable const&, u64 display_list_generation, Vector<GC::Ref<Animations::KeyframeEffect>>& effects);
+
+    AccumulatedVisualContext const& target() const { return m_target; }
+
+    AnimatedVisualContextValue sample(MonotonicTime) const;
+
+    // https://www.w3.org/TR/web-animations-1/#transformed-progress
+    Optional<double> transformed_progress(MonotonicTime) const;
+
+private:
+    CompositorAnimation(NonnullRefPtr<AccumulatedVisualContext const> target, Timing, Vector<Keyframe>, Value underlying_value, Gfx::FloatMatrix4x4 transform_prefix);
+
+    AnimatedVisualContextValue to_visual_context_value(Value const&) const;
+
+    NonnullRefPtr<AccumulatedVisualContext const> m_target;
+    Timing m_timing;
+    Vector<Keyframe> m_keyframes;
+    Value m_underlying_value;
+    Gfx::FloatMatrix4x4 m_transform_prefix;
+};
+
+}
@@ -39,9 +39,10 @@ static bool command_is_clip_or_mask(DisplayListCommand const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface, AnimatedVisualContextValues animated_visual_context_values)
 {
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
+    TemporaryChange animated_values_change { m_animated_visual_context_values, move(animated_visual_context_values) };
     if (surface) {
         surface->lock_context();
     }
@@ -108,12 +109,17 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
     };
 
     auto apply_accumulated_visual_context = [&](AccumulatedVisualContext const& node) {
+        Optional<AnimatedVisualContextValue> animated_value;
+        if (!m_animated_visual_context_values.is_empty())
+            animated_value = m_animated_visual_context_values.get(&node);
+
         node.data().visit(
             [&](EffectsData const& effects) {
                 Optional<Gfx::Filter> gfx_filter;
                 if (effects.filter.has_filters())
                     gfx_filter = to_gfx_filter(effects.filter, device_pixels_per_css_pixel);
-                apply_effects({ .opacity = effects.opacity, .compositing_and_blending_operator = effects.blend_mode, .filter = gfx_filter });
+                auto opacity = animated_value.has_value() ? animated_value->get<float>() : effects.opacity;
+                apply_effects({ .opacity = opacity, .compositing_and_blending_operator = effects.blend_mode, .filter = gfx_filter });
             },
             [&](PerspectiveData const& perspective) {
                 save({});
@@ -131,7 +137,8 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
             [&](TransformData const& transform) {
                 save({});
                 auto origin = transform.origin.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<float>();
-                auto matrix = scale_matrix_for_device_pixels(transform.matrix, static_cast<float>(device_pixels_per_css_pixel));
+                auto css_matrix = animated_value.has_value() ? animated_value->get<Gfx::FloatMatrix4x4>() : transform.matrix;
+                auto matrix = scale_matrix_for_device_pixels(css_matrix, static_cast<float>(device_pixels_per_css_pixel));
                 apply_transform(origin, matrix);
             },
             [&](ClipData const& clip) {
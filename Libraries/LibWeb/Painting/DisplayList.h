@@ -24,13 +24,14 @@ class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>);
+    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>, AnimatedVisualContextValues = {});
 
 protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
     void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>);
 
     ScrollStateSnapshotByDisplayList m_scroll_state_snapshots_by_display_list;
+    AnimatedVisualContextValues m_animated_visual_context_values;
 
 private:
     virtual void flush() = 0;
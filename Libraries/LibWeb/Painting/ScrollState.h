@@ -21,6 +21,13 @@ public:
         return own_offsets[id];
     }
 
+    void set_own_offset_for_frame_with_id(size_t id, CSSPixelPoint offset)
+    {
+        if (id >= own_offsets.size())
+            return;
+        own_offsets[id] = offset;
+    }
+
 private:
     Vector<CSSPixelPoint> own_offsets;
 };
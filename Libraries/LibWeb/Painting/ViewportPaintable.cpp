@@ -8,6 +8,7 @@
 #include <LibWeb/CSS/PropertyID.h>
 #include <LibWeb/CSS/VisualViewport.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/Range.h>
 #include <LibWeb/Layout/TextNode.h>
 #include <LibWeb/Layout/Viewport.h>
@@ -279,9 +280,18 @@ static Optional<ClipData> compute_clip_data(PaintableBox const& paintable_box, C
     return {};
 }
 
+static bool has_animations(PaintableBox const& paintable_box)
+{
+    if (paintable_box.layout_node().is_generated_for_pseudo_element())
+        return false;
+    auto const* element = as_if<DOM::Element>(paintable_box.dom_node().ptr());
+    return element && !element->associated_animations().is_empty();
+}
+
 void ViewportPaintable::assign_accumulated_visual_contexts()
 {
     m_next_accumulated_visual_context_id = 1;
+    m_animatable_visual_contexts.clear_with_capacity();
 
     auto append_node = [&](RefPtr<AccumulatedVisualContext const> parent, VisualContextData data) {
         return AccumulatedVisualContext::create(allocate_accumulated_visual_context_id(), move(data), parent);
@@ -361,16 +371,24 @@ void ViewportPaintable::assign_accumulated_visual_contexts()
 
         auto const& computed_values = paintable_box.computed_values();
 
-        if (auto effects = make_effects_data(paintable_box); effects.has_value())
+        RefPtr<AccumulatedVisualContext const> effects_context;
+        if (auto effects = make_effects_data(paintable_box); effects.has_value()) {
             own_state = append_node(own_state, effects.release_value());
+            effects_context = own_state;
+        }
 
+        RefPtr<AccumulatedVisualContext const> transform_context;
         if (auto transform_data = compute_transform(paintable_box, computed_values); transform_data.has_value()) {
             paintable_box.set_has_non_invertible_css_transform(!transform_data->matrix.is_invertible());
             own_state = append_node(own_state, *transform_data);
+            transform_context = own_state;
         } else {
             paintable_box.set_has_non_invertible_css_transform(false);
         }
 
+        if ((effects_context || transform_context) && has_animations(paintable_box))
+            m_animatable_visual_contexts.append({ paintable_box, move(effects_context), move(transform_context) });
+
         if (auto css_clip = paintable_box.get_clip_rect(); css_clip.has_value())
             own_state = append_node(own_state, ClipData { effective_css_clip_rect(*css_clip), {} });
 
@@ -577,6 +595,8 @@ void ViewportPaintable::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_paintable_boxes_with_auto_content_visibility);
+    for (auto const& contexts : m_animatable_visual_contexts)
+        visitor.visit(contexts.paintable_box);
 }
 
 }
@@ -48,6 +48,15 @@ public:
 
     size_t allocate_accumulated_visual_context_id() { return m_next_accumulated_visual_context_id++; }
 
+    // The effects and transform nodes of boxes whose elements have animations, so that CompositorAnimation can find
+    // the nodes that an opacity or transform animation would change.
+    struct AnimatableVisualContexts {
+        GC::Ref<PaintableBox const> paintable_box;
+        RefPtr<AccumulatedVisualContext const> effects;
+        RefPtr<AccumulatedVisualContext const> transform;
+    };
+    ReadonlySpan<AnimatableVisualContexts> animatable_visual_contexts() const { return m_animatable_visual_contexts; }
+
 private:
     virtual bool is_viewport_paintable() const override { return true; }
 
@@ -64,6 +73,7 @@ private:
     Vector<GC::Ref<PaintableBox>> m_paintable_boxes_with_auto_content_visibility;
 
     size_t m_next_accumulated_visual_context_id { 1 };
+    Vector<AnimatableVisualContexts> m_animatable_visual_contexts;
 
     RefPtr<AccumulatedVisualContext const> m_visual_viewport_context;
 };
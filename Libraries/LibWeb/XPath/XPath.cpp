@@ -11,7 +11,6 @@
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/DocumentFragment.h>
 #include <LibWeb/DOM/Element.h>
-#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/DOM/NodeType.h>
 #include <LibWeb/DOM/ProcessingInstruction.h>
@@ -40,7 +39,7 @@ static xmlNodePtr mirror_node(xmlDocPtr doc, DOM::Node const& node)
         auto* xml_element = xmlNewDocNode(doc, nullptr, bit_cast<xmlChar const*>(name.characters()), nullptr);
         xml_element->_private = bit_cast<void*>(&node);
         for (size_t i = 0; i < element.attribute_list_size(); ++i) {
-            auto const& attribute = *element.attributes()->item(i);
+            auto const& attribute = *element.attribute_list().node_at(i);
             ByteString attr_name = attribute.name().bytes_as_string_view();
             ByteString attr_value = attribute.value().bytes_as_string_view();
             auto* attr = xmlSetProp(xml_element, bit_cast<xmlChar const*>(attr_name.characters()), bit_cast<xmlChar const*>(attr_value.characters()));
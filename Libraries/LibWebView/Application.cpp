@@ -7,6 +7,7 @@
 #include <AK/Debug.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/Environment.h>
+#include <LibCore/MemoryPressureWatcher.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibCore/TimeZoneWatcher.h>
@@ -414,6 +415,17 @@ ErrorOr<void> Application::launch_services()
         }
     }
 
+    if (auto memory_pressure_watcher = Core::MemoryPressureWatcher::create(); !memory_pressure_watcher.is_error()) {
+        m_memory_pressure_watcher = memory_pressure_watcher.release_value();
+
+        m_memory_pressure_watcher->on_memory_pressure = [] {
+            WebContentClient::for_each_client([&](WebView::WebContentClient& client) {
+                client.async_system_memory_pressure();
+                return IterationDecision::Continue;
+            });
+        };
+    }
+
     TRY(launch_request_server());
     TRY(launch_image_decoder_server());
 
@@ -1326,6 +1338,31 @@ void Application::stop_listening_for_console_messages(DevTools::TabDescription c
     view->on_console_message = nullptr;
 }
 
+void Application::start_js_profiler(DevTools::TabDescription const& description, AK::Duration sampling_interval) const
+{
+    auto view = ViewImplementation::find_view_by_id(description.id);
+    if (!view.has_value())
+        return;
+
+    view->start_js_profiler(sampling_interval);
+}
+
+void Application::stop_js_profiler(DevTools::TabDescription const& description, OnJSProfileReceived on_complete) const
+{
+    auto view = ViewImplementation::find_view_by_id(description.id);
+    if (!view.has_value()) {
+        on_complete(Error::from_string_literal("Unable to locate tab"));
+        return;
+    }
+
+    view->on_received_js_profile = [&view = *view, on_complete = move(on_complete)](JsonValue profile) {
+        view.on_received_js_profile = nullptr;
+        on_complete(move(profile));
+    };
+
+    view->stop_js_profiler();
+}
+
 void Application::listen_for_network_events(DevTools::TabDescription const& description, OnNetworkRequestStarted on_request_started, OnNetworkResponseHeadersReceived on_response_headers, OnNetworkResponseBodyReceived on_response_body, OnNetworkRequestFinished on_request_finished) const
 {
     auto view = ViewImplementation::find_view_by_id(description.id);
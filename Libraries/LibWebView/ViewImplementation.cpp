@@ -475,6 +475,16 @@ void ViewImplementation::js_console_input(String const& js_source)
     client().async_js_console_input(page_id(), js_source);
 }
 
+void ViewImplementation::start_js_profiler(AK::Duration sampling_interval)
+{
+    client().async_start_js_profiler(page_id(), static_cast<u32>(max<i64>(1, sampling_interval.to_milliseconds())));
+}
+
+void ViewImplementation::stop_js_profiler()
+{
+    client().async_stop_js_profiler(page_id());
+}
+
 void ViewImplementation::alert_closed()
 {
     client().async_alert_closed(page_id());
@@ -134,6 +134,9 @@ public:
     void run_javascript(String const&);
     void js_console_input(String const&);
 
+    void start_js_profiler(AK::Duration sampling_interval);
+    void stop_js_profiler();
+
     void alert_closed();
     void confirm_closed(bool accepted);
     void prompt_closed(Optional<String> const& response);
@@ -219,6 +222,7 @@ public:
     Function<void(Web::CSS::StyleSheetIdentifier const&, URL::URL const&, String const&)> on_received_style_sheet_source;
     Function<void(JsonValue)> on_received_js_console_result;
     Function<void(ConsoleOutput)> on_console_message;
+    Function<void(JsonValue)> on_received_js_profile;
     Function<void(u64 request_id, URL::URL const&, ByteString const&, Vector<HTTP::Header> const&, ByteBuffer, Optional<String>)> on_network_request_started;
     Function<void(u64 request_id, u32 status_code, Optional<String> const&, Vector<HTTP::Header> const&)> on_network_response_headers_received;
     Function<void(u64 request_id, ByteBuffer)> on_network_response_body_received;
@@ -444,6 +444,14 @@ void WebContentClient::did_output_js_console_message(u64 page_id, ConsoleOutput
     }
 }
 
+void WebContentClient::did_stop_js_profiler(u64 page_id, JsonValue profile)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value()) {
+        if (view->on_received_js_profile)
+            view->on_received_js_profile(move(profile));
+    }
+}
+
 void WebContentClient::did_start_network_request(u64 page_id, u64 request_id, URL::URL url, ByteString method, Vector<HTTP::Header> request_headers, ByteBuffer request_body, Optional<String> initiator_type)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
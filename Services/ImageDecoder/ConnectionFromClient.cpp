@@ -248,6 +248,11 @@ void ConnectionFromClient::request_animation_frames(i64 session_id, u32 start_fr
     if (start_frame_index >= frame_count)
         return;
 
+    if (m_pending_frame_jobs.contains(session_id)) {
+        session.queued_frame_requests.append({ start_frame_index, count });
+        return;
+    }
+
     u32 const end_index = min(frame_count, start_frame_index + min(count, frame_count - start_frame_index));
 
     auto job = FrameDecodeJob::construct(
@@ -267,18 +272,30 @@ void ConnectionFromClient::request_animation_frames(i64 session_id, u32 start_fr
             for (auto& frame : frames)
                 bitmaps.unchecked_append(move(frame.image));
             strong_this->async_did_decode_animation_frames(session_id, Gfx::BitmapSequence { move(bitmaps) });
-            strong_this->m_pending_frame_jobs.remove(session_id);
+            strong_this->did_finish_frame_decode_job(session_id);
             return {};
         },
         [strong_this = NonnullRefPtr(*this), session_id](Error error) -> void {
             if (strong_this->is_open())
                 strong_this->async_did_fail_animation_decode(session_id, MUST(String::formatted("Frame decode failed: {}", error)));
-            strong_this->m_pending_frame_jobs.remove(session_id);
+            strong_this->did_finish_frame_decode_job(session_id);
         });
 
     m_pending_frame_jobs.set(session_id, move(job));
 }
 
+void ConnectionFromClient::did_finish_frame_decode_job(i64 session_id)
+{
+    m_pending_frame_jobs.remove(session_id);
+
+    auto it = m_animation_sessions.find(session_id);
+    if (it == m_animation_sessions.end() || it->value->queued_frame_requests.is_empty())
+        return;
+
+    auto request = it->value->queued_frame_requests.take_first();
+    request_animation_frames(session_id, request.start_frame_index, request.count);
+}
+
 void ConnectionFromClient::stop_animation_decode(i64 session_id)
 {
     if (auto job = m_pending_frame_jobs.take(session_id); job.has_value())
@@ -46,6 +46,13 @@ public:
         Core::AnonymousBuffer encoded_data;
         RefPtr<Gfx::ImageDecoder> decoder;
         u32 frame_count { 0 };
+
+        // Frames are decoded one request at a time, as the decoder must not be used from two threads at once.
+        struct FrameRequest {
+            u32 start_frame_index { 0 };
+            u32 count { 0 };
+        };
+        Vector<FrameRequest> queued_frame_requests;
     };
 
 private:
@@ -64,6 +71,8 @@ private:
 
     ErrorOr<IPC::File> connect_new_client();
 
+    void did_finish_frame_decode_job(i64 session_id);
+
     NonnullRefPtr<Job> make_decode_image_job(i64 image_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
 
     i64 m_next_image_id { 0 };
@@ -19,12 +19,14 @@
 #include <LibGfx/SystemTheme.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/CustomPropertyData.h>
 #include <LibWeb/CSS/Parser/ErrorReporter.h>
+#include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/CookieStore/CookieStore.h>
@@ -214,6 +216,14 @@ void ConnectionFromClient::key_event(u64 page_id, Web::KeyEvent event)
 
 void ConnectionFromClient::mouse_event(u64 page_id, Web::MouseEvent event)
 {
+    // OPTIMIZATION: Scroll the viewport on the rendering thread right away, instead of waiting for the event to be
+    //               processed during the next rendering update.
+    Optional<Web::CSSPixelPoint> asynchronous_scroll_delta;
+    if (event.type == Web::MouseEvent::Type::MouseWheel) {
+        if (auto page = this->page(page_id); page.has_value())
+            asynchronous_scroll_delta = page->page().handle_asynchronous_mousewheel(event.position, event.modifiers, event.wheel_delta_x, event.wheel_delta_y);
+    }
+
     // OPTIMIZATION: Coalesce consecutive unprocessed mouse move and wheel events.
     auto event_to_coalesce = [&]() -> Web::MouseEvent const* {
         if (m_input_event_queue.is_empty())
@@ -223,6 +233,8 @@ void ConnectionFromClient::mouse_event(u64 page_id, Web::MouseEvent event)
 
         if (event.type != Web::MouseEvent::Type::MouseMove && event.type != Web::MouseEvent::Type::MouseWheel)
             return nullptr;
+        if (m_input_event_queue.tail().asynchronous_scroll_delta.has_value() != asynchronous_scroll_delta.has_value())
+            return nullptr;
 
         if (auto const* mouse_event = m_input_event_queue.tail().event.get_pointer<Web::MouseEvent>()) {
             if (mouse_event->type == event.type)
@@ -236,13 +248,16 @@ void ConnectionFromClient::mouse_event(u64 page_id, Web::MouseEvent event)
         event.wheel_delta_x += last_mouse_event->wheel_delta_x;
         event.wheel_delta_y += last_mouse_event->wheel_delta_y;
 
-        m_input_event_queue.tail().event = move(event);
-        ++m_input_event_queue.tail().coalesced_event_count;
+        auto& tail = m_input_event_queue.tail();
+        if (asynchronous_scroll_delta.has_value())
+            *tail.asynchronous_scroll_delta += *asynchronous_scroll_delta;
+        tail.event = move(event);
+        ++tail.coalesced_event_count;
 
         return;
     }
 
-    enqueue_input_event({ page_id, move(event), 0 });
+    enqueue_input_event({ page_id, move(event), 0, asynchronous_scroll_delta });
 }
 
 void ConnectionFromClient::drag_event(u64 page_id, Web::DragEvent event)
@@ -1278,6 +1293,25 @@ void ConnectionFromClient::run_javascript(u64 page_id, String js_source)
         page->run_javascript(js_source);
 }
 
+void ConnectionFromClient::start_js_profiler(u64 page_id, u32 sampling_interval_in_milliseconds)
+{
+    if (!this->page(page_id).has_value())
+        return;
+
+    // NB: All pages of this process share the main thread VM, so the profile covers all of them.
+    Web::Bindings::main_thread_vm().sampling_profiler().start(AK::Duration::from_milliseconds(sampling_interval_in_milliseconds));
+}
+
+void ConnectionFromClient::stop_js_profiler(u64 page_id)
+{
+    if (!this->page(page_id).has_value())
+        return;
+
+    auto& profiler = Web::Bindings::main_thread_vm().sampling_profiler();
+    profiler.stop();
+    async_did_stop_js_profiler(page_id, profiler.to_gecko_profile());
+}
+
 void ConnectionFromClient::alert_closed(u64 page_id)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -1362,6 +1396,11 @@ void ConnectionFromClient::system_time_zone_changed()
     Unicode::clear_system_time_zone_cache();
 }
 
+void ConnectionFromClient::system_memory_pressure()
+{
+    Web::CSS::Parser::Parser::clear_shared_stylesheet_contents_cache();
+}
+
 void ConnectionFromClient::set_document_cookie_version_buffer(u64 page_id, Core::AnonymousBuffer document_cookie_version_buffer)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -129,6 +129,9 @@ private:
     virtual void js_console_input(u64 page_id, String) override;
     virtual void run_javascript(u64 page_id, String) override;
 
+    virtual void start_js_profiler(u64 page_id, u32 sampling_interval_in_milliseconds) override;
+    virtual void stop_js_profiler(u64 page_id) override;
+
     virtual void alert_closed(u64 page_id) override;
     virtual void confirm_closed(u64 page_id, bool accepted) override;
     virtual void prompt_closed(u64 page_id, Optional<String> response) override;
@@ -162,6 +165,7 @@ private:
     virtual void paste(u64 page_id, Utf16String text) override;
 
     virtual void system_time_zone_changed() override;
+    virtual void system_memory_pressure() override;
 
     virtual void set_document_cookie_version_buffer(u64 page_id, Core::AnonymousBuffer document_cookie_version_buffer) override;
     virtual void set_document_cookie_version_index(u64 page_id, i64 document_id, Core::SharedVersionIndex document_index) override;
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Utf16String.h>
+#include <LibCore/MappedFile.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibGfx/TextLayout.h>
+#include <LibTest/TestCase.h>
+
+#define TEST_INPUT(x) ("test-inputs/" x)
+
+using ShapingCache = Gfx::Font::ShapingCache;
+
+static NonnullRefPtr<Gfx::Font> load_test_font()
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    auto typeface = MUST(WOFF2::try_load_from_bytes(file->bytes()));
+    return typeface->font(12);
+}
+
+TEST_CASE(shaping_cache_is_bounded)
+{
+    auto font = load_test_font();
+    auto& cache = font->shaping_cache();
+
+    for (size_t i = 0; i < ShapingCache::MAXIMUM_ENTRY_COUNT; ++i)
+        (void)Gfx::measure_text_width(Utf16String::formatted("text {}", i), *font);
+    EXPECT_EQ(cache.map.size(), ShapingCache::MAXIMUM_ENTRY_COUNT);
+
+    // Using the first entry again makes it the most recently used one, so it survives the next eviction.
+    auto first = Utf16String::formatted("text {}", 0);
+    (void)Gfx::measure_text_width(first, *font);
+
+    auto one_more = Utf16String::from_utf8("one more"sv);
+    (void)Gfx::measure_text_width(one_more, *font);
+    EXPECT(cache.map.size() <= ShapingCache::MAXIMUM_ENTRY_COUNT / 2 + 1);
+    EXPECT(cache.find(first, ShapingCache::Direction::Auto));
+    EXPECT(cache.find(one_more, ShapingCache::Direction::Auto));
+    EXPECT(!cache.find(Utf16String::formatted("text {}", 1), ShapingCache::Direction::Auto));
+}
+
+TEST_CASE(shaping_cache_is_keyed_on_direction)
+{
+    auto font = load_test_font();
+    auto& cache = font->shaping_cache();
+
+    auto text = Utf16String::from_utf8("שלום abc"sv);
+    (void)Gfx::shape_text({}, 0, text, *font, Gfx::GlyphRun::TextType::Ltr);
+    (void)Gfx::shape_text({}, 0, text, *font, Gfx::GlyphRun::TextType::Rtl);
+
+    auto* ltr_buffer = cache.find(text, ShapingCache::Direction::Ltr);
+    auto* rtl_buffer = cache.find(text, ShapingCache::Direction::Rtl);
+    EXPECT(ltr_buffer);
+    EXPECT(rtl_buffer);
+    EXPECT_NE(ltr_buffer, rtl_buffer);
+    EXPECT(!cache.find(text, ShapingCache::Direction::Auto));
+
+    // ASCII text is always shaped left-to-right, so it shares one entry regardless of the requested direction.
+    auto ascii_text = Utf16String::from_utf8("plain ascii"sv);
+    (void)Gfx::shape_text({}, 0, ascii_text, *font, Gfx::GlyphRun::TextType::Ltr);
+    (void)Gfx::shape_text({}, 0, ascii_text, *font, Gfx::GlyphRun::TextType::Rtl);
+    EXPECT(cache.find(ascii_text, ShapingCache::Direction::Auto));
+    EXPECT_EQ(cache.map.size(), 3u);
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/MappedFile.h>
+#include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibTest/TestCase.h>
+
+#define TEST_INPUT(x) ("test-inputs/" x)
+
+static ErrorOr<NonnullRefPtr<Gfx::Typeface const>> decode_and_count(ReadonlyBytes bytes, size_t& decode_count)
+{
+    ++decode_count;
+    return WOFF2::try_load_from_bytes(bytes);
+}
+
+TEST_CASE(web_fonts_are_shared_within_a_partition)
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    size_t decode_count = 0;
+    auto decode = [&](ReadonlyBytes bytes) { return decode_and_count(bytes, decode_count); };
+
+    auto partition = "https://example.com"_string;
+    auto first = MUST(Gfx::FontDatabase::the().get_or_decode_web_font(file->bytes(), partition, decode));
+    auto second = MUST(Gfx::FontDatabase::the().get_or_decode_web_font(file->bytes(), partition, decode));
+    EXPECT_EQ(first.ptr(), second.ptr());
+    EXPECT_EQ(decode_count, 1u);
+}
+
+TEST_CASE(web_fonts_are_not_shared_across_partitions)
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    size_t decode_count = 0;
+    auto decode = [&](ReadonlyBytes bytes) { return decode_and_count(bytes, decode_count); };
+
+    auto first = MUST(Gfx::FontDatabase::the().get_or_decode_web_font(file->bytes(), "https://a.test"_string, decode));
+    auto second = MUST(Gfx::FontDatabase::the().get_or_decode_web_font(file->bytes(), "https://b.test"_string, decode));
+    EXPECT_NE(first.ptr(), second.ptr());
+    EXPECT_EQ(decode_count, 2u);
+}
+
+TEST_CASE(web_fonts_without_a_partition_are_not_cached)
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    size_t decode_count = 0;
+    auto decode = [&](ReadonlyBytes bytes) { return decode_and_count(bytes, decode_count); };
+
+    auto first = MUST(Gfx::FontDatabase::the().get_or_decode_web_font(file->bytes(), {}, decode));
+    auto second = MUST(Gfx::FontDatabase::the().get_or_decode_web_font(file->bytes(), {}, decode));
+    EXPECT_NE(first.ptr(), second.ptr());
+    EXPECT_EQ(decode_count, 2u);
+}
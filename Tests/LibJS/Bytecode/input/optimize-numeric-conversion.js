@@ -0,0 +1,4 @@
+function f(x) {
+    return +(x | 0);
+}
+f(10);
@@ -0,0 +1,5 @@
+function f(x) {
+    x--;
+    return x;
+}
+f(10);
@@ -0,0 +1,84 @@
+describe("arrays of numbers", () => {
+    test("storing other values makes them generic", () => {
+        var a = [1, 2, 3];
+        a[1] = 2.5;
+        expect(a.indexOf(2.5)).toBe(1);
+        a[2] = "3";
+        expect(a.indexOf("3")).toBe(2);
+        expect(a.indexOf(3)).toBe(-1);
+        a.push({});
+        expect(a).toHaveLength(4);
+        expect(a.includes(1)).toBeTrue();
+    });
+
+    test("searching for non-numbers", () => {
+        var a = [1, 2.5, -0];
+        expect(a.indexOf("1")).toBe(-1);
+        expect(a.lastIndexOf(undefined)).toBe(-1);
+        expect(a.includes(null)).toBeFalse();
+        expect(a.includes(undefined)).toBeFalse();
+        expect(a.indexOf(0)).toBe(2);
+        expect(a.includes(NaN)).toBeFalse();
+        expect([1, NaN].includes(NaN)).toBeTrue();
+        expect([1, NaN].indexOf(NaN)).toBe(-1);
+    });
+
+    test("holes", () => {
+        var a = [1, , 3];
+        expect(a.indexOf(undefined)).toBe(-1);
+        expect(a.includes(undefined)).toBeTrue();
+        expect(a.lastIndexOf(3)).toBe(2);
+        expect(a.map(x => x * 2)).toEqual([2, , 6]);
+
+        a.length = 5;
+        expect(a.includes(undefined, 3)).toBeTrue();
+        expect(a.lastIndexOf(1, 10)).toBe(0);
+    });
+
+    test("holes read through the prototype chain", () => {
+        var a = [1, , 3];
+        Array.prototype[1] = 2;
+        try {
+            expect(a.indexOf(2)).toBe(1);
+            expect(a.includes(2)).toBeTrue();
+            expect(a.map(x => x)).toEqual([1, 2, 3]);
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+
+    test("map sees changes made by the callback", () => {
+        var a = [1, 2, 3, 4];
+        var result = a.map((x, i) => {
+            if (i === 0) {
+                a[1] = "two";
+                a.length = 3;
+            }
+            return x;
+        });
+        expect(result).toEqual([1, "two", 3, ,]);
+    });
+
+    test("sorting without a comparefn sorts by string representation", () => {
+        var a = [10, 9, 1.5, -0, 0, -1, 100, Infinity, NaN];
+        expect(a.sort()).toEqual([-1, -0, 0, 1.5, 10, 100, 9, Infinity, NaN]);
+        expect(Object.is(a[1], -0)).toBeTrue();
+
+        var b = [3, , 2, , 1];
+        expect(b.toSorted()).toEqual([1, 2, 3, undefined, undefined]);
+        expect(b.sort()).toEqual([1, 2, 3, , ,]);
+        expect(b).toHaveLength(5);
+    });
+
+    test("push onto non-extensible arrays and arrays with a non-writable length", () => {
+        var a = [1, 2];
+        Object.preventExtensions(a);
+        expect(() => a.push(3)).toThrow(TypeError);
+        expect(a).toHaveLength(2);
+
+        var b = [1];
+        Object.defineProperty(b, "length", { writable: false });
+        expect(() => b.push(2)).toThrow(TypeError);
+        expect(b).toHaveLength(1);
+    });
+});
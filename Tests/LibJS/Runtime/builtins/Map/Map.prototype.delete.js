@@ -82,4 +82,19 @@ describe("modification with active iterators", () => {
         expect(iterator.next()).toBeIteratorResultDone();
         expect(iterator.next()).toBeIteratorResultDone();
     });
+
+    test("iterator keeps its position when the map is compacted", () => {
+        const map = new Map();
+        for (let i = 0; i < 1000; ++i) map.set(i, i);
+
+        const iterator = map.keys();
+        for (let i = 0; i < 500; ++i) expect(iterator.next()).toBeIteratorResultWithValue(i);
+
+        // Delete most entries and add new ones, so that the map has to rehash while the iterator is live.
+        for (let i = 0; i < 990; ++i) expect(map.delete(i)).toBeTrue();
+        for (let i = 1000; i < 2000; ++i) map.set(i, i);
+
+        for (let i = 990; i < 2000; ++i) expect(iterator.next()).toBeIteratorResultWithValue(i);
+        expect(iterator.next()).toBeIteratorResultDone();
+    });
 });
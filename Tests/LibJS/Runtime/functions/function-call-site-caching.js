@@ -0,0 +1,125 @@
+describe("calls through cached call sites", () => {
+    test("missing arguments are undefined", () => {
+        function f(a, b, c) {
+            return [a, b, c, arguments.length];
+        }
+        for (let i = 0; i < 3; i++) {
+            expect(f(1)).toEqual([1, undefined, undefined, 1]);
+            expect(f(1, 2, 3, 4)).toEqual([1, 2, 3, 4]);
+        }
+    });
+
+    test("this binding in sloppy and strict mode functions", () => {
+        function sloppy() {
+            return this;
+        }
+        function strict() {
+            "use strict";
+            return this;
+        }
+        const o = { sloppy, strict };
+        for (let i = 0; i < 3; i++) {
+            expect(sloppy()).toBe(globalThis);
+            expect(strict()).toBeUndefined();
+            expect(o.sloppy()).toBe(o);
+            expect(o.strict()).toBe(o);
+            expect(typeof sloppy.call(1)).toBe("object");
+            expect(strict.call(1)).toBe(1);
+        }
+    });
+
+    test("polymorphic call sites call the right function", () => {
+        const functions = [];
+        for (let i = 0; i < 10; i++) functions.push(() => i);
+
+        function callAll() {
+            const results = [];
+            for (const f of functions) results.push(f());
+            return results;
+        }
+        for (let i = 0; i < 3; i++) expect(callAll()).toEqual([0, 1, 2, 3, 4, 5, 6, 7, 8, 9]);
+    });
+
+    test("closures see their own environment", () => {
+        function makeCounter() {
+            let count = 0;
+            return () => ++count;
+        }
+        const a = makeCounter();
+        const b = makeCounter();
+        const call = f => f();
+        call(a);
+        call(a);
+        expect(call(a)).toBe(3);
+        expect(call(b)).toBe(1);
+    });
+
+    test("closures of the same function share a cache entry but keep their own environment", () => {
+        const closures = [];
+        for (let i = 0; i < 10; i++) {
+            const captured = i * 2;
+            closures.push(function () {
+                return [captured, this];
+            });
+        }
+        const receiver = {};
+        const call = f => f.call(receiver);
+        const direct = f => f();
+        for (let i = 0; i < 3; i++) {
+            for (let j = 0; j < closures.length; j++) {
+                expect(direct(closures[j])[0]).toBe(j * 2);
+                const [captured, thisValue] = call(closures[j]);
+                expect(captured).toBe(j * 2);
+                expect(thisValue).toBe(receiver);
+            }
+        }
+    });
+
+    test("more distinct functions than cache entries at one call site", () => {
+        const functions = [];
+        for (let i = 0; i < 6; i++) functions.push(new Function(`return ${i};`));
+        const call = f => f();
+        for (let i = 0; i < 3; i++) {
+            for (let j = 0; j < functions.length; j++) expect(call(functions[j])).toBe(j);
+        }
+    });
+
+    test("class constructors, generators and async functions", () => {
+        class C {}
+        function* g() {
+            yield 1;
+        }
+        async function af() {
+            return 1;
+        }
+        const call = f => f();
+        for (let i = 0; i < 3; i++) {
+            expect(() => call(C)).toThrowWithMessage(TypeError, "Class constructor C must be called with 'new'");
+            expect(call(g).next().value).toBe(1);
+            expect(call(af)).toBeInstanceOf(Promise);
+        }
+    });
+
+    test("exceptions propagate and recursion works", () => {
+        function thrower() {
+            throw new Error("oops");
+        }
+        function fib(n) {
+            return n < 2 ? n : fib(n - 1) + fib(n - 2);
+        }
+        for (let i = 0; i < 3; i++) expect(thrower).toThrowWithMessage(Error, "oops");
+        expect(fib(15)).toBe(610);
+    });
+
+    test("native and bound functions at a call site that has cached callees", () => {
+        function f(x) {
+            return x + 1;
+        }
+        const call = (callee, x) => callee(x);
+        expect(call(f, 1)).toBe(2);
+        expect(call(Math.abs, -1)).toBe(1);
+        expect(call(f.bind(null, 10), 1)).toBe(11);
+        expect(call(f, 2)).toBe(3);
+        expect(() => call(1, 1)).toThrow(TypeError);
+    });
+});
@@ -257,4 +257,9 @@ describe("scoping in modules", () => {
     test("functions within functions", () => {
         expectModulePassed("./function-in-function.mjs");
     });
+
+    test("lexical bindings and this in a module with top-level await", () => {
+        const result = expectModulePassed("./top-level-await.mjs");
+        expect(result).toHaveProperty("lexicalValue", 3);
+    });
 });
@@ -0,0 +1,30 @@
+let counter = 0;
+const increment = () => ++counter;
+
+const thisBeforeAwait = this;
+const arrowThisBeforeAwait = (() => this)();
+
+await null;
+increment();
+
+{
+    let blockScoped = await Promise.resolve(2);
+    counter += blockScoped;
+}
+
+class C {
+    value() {
+        return counter;
+    }
+}
+
+const thisAfterAwait = this;
+const arrowThisAfterAwait = (() => this)();
+
+export const lexicalValue = new C().value();
+export const passed =
+    counter === 3 &&
+    thisBeforeAwait === undefined &&
+    arrowThisBeforeAwait === undefined &&
+    thisAfterAwait === undefined &&
+    arrowThisAfterAwait === undefined;
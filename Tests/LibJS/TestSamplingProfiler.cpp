@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibCore/System.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+static constexpr auto busy_script = R"~~~(
+function busy(milliseconds) {
+    let iterations = 0;
+    const end = Date.now() + milliseconds;
+    while (Date.now() < end)
+        iterations++;
+    return iterations;
+}
+function outer() {
+    return busy(50);
+}
+outer();
+)~~~"sv;
+
+static void run_script(JS::Realm& realm, StringView source)
+{
+    auto script = JS::Script::parse(source, realm, "profile.js"sv);
+    VERIFY(!script.is_error());
+    MUST(realm.vm().bytecode_interpreter().run(*script.release_value()));
+}
+
+static JS::SamplingProfiler& profile_script(JS::VM& vm, StringView source)
+{
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(vm);
+    auto& profiler = vm.sampling_profiler();
+    profiler.start();
+    run_script(*execution_context->realm, source);
+    profiler.stop();
+    return profiler;
+}
+
+TEST_CASE(cpuprofile_structure)
+{
+    auto vm = JS::VM::create();
+    auto profile = profile_script(*vm, busy_script).to_cpuprofile();
+
+    auto const& nodes = profile.get_array("nodes"sv).value();
+    auto const& samples = profile.get_array("samples"sv).value();
+    auto const& time_deltas = profile.get_array("timeDeltas"sv).value();
+    EXPECT(!samples.is_empty());
+    EXPECT_EQ(samples.size(), time_deltas.size());
+    EXPECT(profile.get_integer<i64>("startTime"sv).value() <= profile.get_integer<i64>("endTime"sv).value());
+
+    auto function_name_of = [&](size_t id) {
+        return nodes[id - 1].as_object().get_object("callFrame"sv)->get_string("functionName"sv).value();
+    };
+    EXPECT_EQ(function_name_of(1), "(root)"sv);
+
+    // Node IDs are one-based and dense, and every node but the root has exactly one parent.
+    Vector<size_t> parents;
+    parents.resize(nodes.size() + 1);
+    u64 total_hit_count = 0;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        auto const& node = nodes[i].as_object();
+        EXPECT_EQ(node.get_integer<size_t>("id"sv).value(), i + 1);
+        total_hit_count += node.get_integer<u64>("hitCount"sv).value();
+
+        auto children = node.get_array("children"sv);
+        if (!children.has_value())
+            continue;
+        children->for_each([&](JsonValue const& child) {
+            auto child_id = child.get_integer<size_t>().value();
+            EXPECT(child_id > 1 && child_id <= nodes.size());
+            EXPECT_EQ(parents[child_id], 0u);
+            parents[child_id] = i + 1;
+        });
+    }
+    EXPECT(total_hit_count >= samples.size());
+
+    samples.for_each([&](JsonValue const& sample) {
+        auto id = sample.get_integer<size_t>().value();
+        EXPECT(id >= 1 && id <= nodes.size());
+    });
+
+    // The busy loop shows up below the function that called it, somewhere in the script it was declared in.
+    bool found_busy = false;
+    for (size_t id = 2; id <= nodes.size(); ++id) {
+        if (function_name_of(id) != "busy"sv)
+            continue;
+        found_busy = true;
+        EXPECT_EQ(function_name_of(parents[id]), "outer"sv);
+
+        auto const& call_frame = nodes[id - 1].as_object().get_object("callFrame"sv).value();
+        EXPECT_EQ(call_frame.get_string("url"sv).value(), "profile.js"sv);
+        EXPECT(call_frame.get_integer<i32>("lineNumber"sv).value() >= 1);
+    }
+    EXPECT(found_busy);
+}
+
+TEST_CASE(gecko_profile_structure)
+{
+    auto vm = JS::VM::create();
+    auto profile = profile_script(*vm, busy_script).to_gecko_profile();
+
+    EXPECT(profile.get_object("meta"sv)->get_double_with_precision_loss("interval"sv).value() > 0);
+
+    auto const& threads = profile.get_array("threads"sv).value();
+    EXPECT_EQ(threads.size(), 1u);
+    auto const& thread = threads[0].as_object();
+
+    auto const& string_table = thread.get_array("stringTable"sv).value();
+    auto const& frames = thread.get_object("frameTable"sv)->get_array("data"sv).value();
+    auto const& stacks = thread.get_object("stackTable"sv)->get_array("data"sv).value();
+    auto const& samples = thread.get_object("samples"sv)->get_array("data"sv).value();
+    EXPECT(!samples.is_empty());
+
+    Vector<String> locations;
+    frames.for_each([&](JsonValue const& frame) {
+        auto location = frame.as_array()[0].get_integer<size_t>().value();
+        EXPECT(location < string_table.size());
+        locations.append(string_table[location].as_string());
+    });
+
+    // Stacks only ever refer to earlier stacks as their prefix.
+    for (size_t i = 0; i < stacks.size(); ++i) {
+        auto const& stack = stacks[i].as_array();
+        if (!stack[0].is_null())
+            EXPECT(stack[0].get_integer<size_t>().value() < i);
+        EXPECT(stack[1].get_integer<size_t>().value() < frames.size());
+    }
+
+    double last_time = 0;
+    samples.for_each([&](JsonValue const& sample) {
+        auto const& row = sample.as_array();
+        if (!row[0].is_null())
+            EXPECT(row[0].get_integer<size_t>().value() < stacks.size());
+        auto time = row[1].get_double_with_precision_loss().value();
+        EXPECT(time >= last_time);
+        last_time = time;
+    });
+
+    EXPECT(any_of(locations, [](auto const& location) { return location.starts_with_bytes("busy (profile.js:"sv); }));
+    EXPECT(any_of(locations, [](auto const& location) { return location.starts_with_bytes("outer (profile.js:"sv); }));
+}
+
+TEST_CASE(time_in_native_functions_is_attributed_to_them)
+{
+    auto vm = JS::VM::create();
+    auto profile = profile_script(*vm, R"~~~(
+const array = Array.from({ length: 200000 }, (_, i) => (i * 7919) % 200000);
+for (let i = 0; i < 10; i++)
+    array.slice().sort();
+)~~~"sv).to_cpuprofile();
+
+    bool found_sort = false;
+    profile.get_array("nodes"sv)->for_each([&](JsonValue const& node) {
+        auto const& object = node.as_object();
+        if (object.get_object("callFrame"sv)->get_string("functionName"sv).value() == "sort"sv && object.get_integer<u32>("hitCount"sv).value() > 0)
+            found_sort = true;
+    });
+    EXPECT(found_sort);
+}
+
+TEST_CASE(idle_time_is_not_charged_to_javascript)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+    auto& profiler = vm->sampling_profiler();
+
+    // NB: Nothing runs between the two scripts, as if the event loop was waiting for work.
+    profiler.start();
+    run_script(realm, "function busy() { const end = Date.now() + 10; while (Date.now() < end); } busy();"sv);
+    (void)Core::System::sleep_ms(200);
+    run_script(realm, "busy();"sv);
+    profiler.stop();
+
+    u64 idle_hit_count = 0;
+    u64 busy_hit_count = 0;
+    profiler.to_cpuprofile().get_array("nodes"sv)->for_each([&](JsonValue const& node) {
+        auto const& object = node.as_object();
+        auto function_name = object.get_object("callFrame"sv)->get_string("functionName"sv).value();
+        auto hit_count = object.get_integer<u64>("hitCount"sv).value();
+        if (function_name == "(idle)"sv)
+            idle_hit_count += hit_count;
+        else if (function_name == "busy"sv)
+            busy_hit_count += hit_count;
+    });
+
+    // The ticks of the idle gap are recorded as idle time, and not merged into the stack of the second script.
+    EXPECT(idle_hit_count >= 50);
+    EXPECT(busy_hit_count < 100);
+
+    // Idle samples are stacks of their own in the Gecko format too, so the idle gap isn't shown as JavaScript.
+    auto gecko_profile = profiler.to_gecko_profile();
+    auto const& thread = gecko_profile.get_array("threads"sv)->at(0).as_object();
+    auto const& string_table = thread.get_array("stringTable"sv).value();
+    auto const& frames = thread.get_object("frameTable"sv)->get_array("data"sv).value();
+    auto const& stacks = thread.get_object("stackTable"sv)->get_array("data"sv).value();
+    size_t idle_samples = 0;
+    thread.get_object("samples"sv)->get_array("data"sv)->for_each([&](JsonValue const& sample) {
+        auto const& stack = sample.as_array()[0];
+        if (stack.is_null())
+            return;
+        auto frame = stacks[stack.get_integer<size_t>().value()].as_array()[1].get_integer<size_t>().value();
+        auto location = frames[frame].as_array()[0].get_integer<size_t>().value();
+        if (string_table[location].as_string() == "(idle)"sv)
+            ++idle_samples;
+    });
+    EXPECT(idle_samples >= 50);
+}
+
+static constexpr auto benchmark_script = R"~~~(
+function fib(n) {
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+fib(27);
+)~~~"sv;
+
+BENCHMARK_CASE(interpreter_without_profiler)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    run_script(*execution_context->realm, benchmark_script);
+}
+
+BENCHMARK_CASE(interpreter_with_profiler)
+{
+    auto vm = JS::VM::create();
+    (void)profile_script(*vm, benchmark_script);
+}
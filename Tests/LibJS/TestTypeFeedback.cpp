@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <AK/ScopeGuard.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/TypeFeedback.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(operand_types)
+{
+    JS::Bytecode::InstructionFeedback feedback;
+    EXPECT(!feedback.is_polymorphic());
+
+    feedback.record_operands(JS::Value(1), JS::Value(2));
+    feedback.record_operands(JS::Value(3), JS::Value(4));
+    EXPECT_EQ(feedback.execution_count, 2u);
+    EXPECT_EQ(feedback.lhs_types, JS::Bytecode::ObservedTypes::Int32);
+    EXPECT_EQ(feedback.rhs_types, JS::Bytecode::ObservedTypes::Int32);
+    EXPECT(!feedback.is_polymorphic());
+
+    feedback.record_operands(JS::Value(1), JS::Value(2.5));
+    EXPECT_EQ(feedback.lhs_types, JS::Bytecode::ObservedTypes::Int32);
+    EXPECT_EQ(feedback.rhs_types, JS::Bytecode::ObservedTypes::Int32 | JS::Bytecode::ObservedTypes::Double);
+    EXPECT(feedback.is_polymorphic());
+}
+
+TEST_CASE(callees)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    auto first_callee = JS::Object::create(realm, nullptr);
+    auto second_callee = JS::Object::create(realm, nullptr);
+
+    JS::Bytecode::InstructionFeedback feedback;
+    feedback.record_callee(*first_callee);
+    feedback.record_callee(*first_callee);
+    EXPECT_EQ(feedback.execution_count, 2u);
+    EXPECT(!feedback.is_polymorphic());
+
+    feedback.record_callee(*second_callee);
+    EXPECT(feedback.has_seen_multiple_callees);
+    EXPECT(feedback.is_polymorphic());
+
+    // Once a call site is polymorphic, it stays that way.
+    feedback.record_callee(*first_callee);
+    EXPECT(feedback.is_polymorphic());
+}
+
+static constexpr auto feedback_script = R"~~~(
+function add(a, b) {
+    return a + b;
+}
+for (let i = 0; i < 10; i++)
+    add(i, 1);
+add("a", 1);
+
+function callIt(f) {
+    return f();
+}
+callIt(() => 1);
+callIt(() => 2);
+
+function monomorphic(o) {
+    return o.x;
+}
+for (let i = 0; i < 10; i++)
+    monomorphic({ x: i });
+)~~~"sv;
+
+TEST_CASE(collects_feedback_into_slots_allocated_at_codegen)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    JS::Bytecode::g_collect_type_feedback = true;
+    ScopeGuard disable_type_feedback = [] { JS::Bytecode::g_collect_type_feedback = false; };
+
+    auto script = JS::Script::parse(feedback_script, realm, "feedback.js"sv);
+    VERIFY(!script.is_error());
+    MUST(vm->bytecode_interpreter().run(*script.release_value()));
+
+    auto feedback_of = [](Utf16FlyString const& name) -> JS::Bytecode::ExecutableFeedback const& {
+        for (auto const& executable : JS::Bytecode::executables_with_type_feedback()) {
+            if (executable->name == name)
+                return *executable->feedback;
+        }
+        VERIFY_NOT_REACHED();
+    };
+
+    auto const& add_feedback = feedback_of("add"_utf16_fly_string);
+    EXPECT_EQ(add_feedback.entry_count, 11u);
+    EXPECT(any_of(add_feedback.instructions, [](auto const& slot) {
+        return slot.execution_count == 11
+            && slot.lhs_types == (JS::Bytecode::ObservedTypes::Int32 | JS::Bytecode::ObservedTypes::String)
+            && slot.rhs_types == JS::Bytecode::ObservedTypes::Int32;
+    }));
+
+    auto const& call_it_feedback = feedback_of("callIt"_utf16_fly_string);
+    EXPECT_EQ(call_it_feedback.entry_count, 2u);
+    EXPECT(any_of(call_it_feedback.instructions, [](auto const& slot) { return slot.has_seen_multiple_callees; }));
+
+    auto const& monomorphic_feedback = feedback_of("monomorphic"_utf16_fly_string);
+    EXPECT(!any_of(monomorphic_feedback.instructions, [](auto const& slot) { return slot.is_polymorphic(); }));
+    EXPECT(any_of(monomorphic_feedback.property_lookups, [](auto const& slot) {
+        return slot.execution_count == 10 && slot.cache_miss_count > 0 && slot.cache_miss_count < slot.execution_count;
+    }));
+}
@@ -67,6 +67,8 @@ def test(file: Path) -> bool:
     ]
     if file.suffix == ".mjs":
         args.append("--as-module")
+    if file.name.startswith("optimize-"):
+        args.append("--optimize-bytecode")
     process = subprocess.run(args, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
 
     stdout = process.stdout.decode().strip()
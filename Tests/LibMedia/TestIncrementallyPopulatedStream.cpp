@@ -290,3 +290,105 @@ TEST_CASE(data_request_callback_invoked)
 
     MUST(thread->join());
 }
+
+TEST_CASE(close_does_not_truncate_expected_size)
+{
+    auto stream = Media::IncrementallyPopulatedStream::create_empty();
+    stream->set_expected_size(200);
+
+    auto data = make_test_data(200);
+    stream->add_chunk_at(100, data.bytes().slice(100));
+    stream->add_chunk_at(0, data.bytes().trim(50));
+    stream->close();
+
+    EXPECT_EQ(stream->expected_size().value(), 200u);
+}
+
+TEST_CASE(evicted_data_is_requested_again)
+{
+    Core::EventLoop loop;
+
+    // The stream starts evicting data once more than 128 MiB is buffered, and retains 64 MiB ahead of the cursors.
+    static constexpr u64 stream_size = 256 * MiB;
+    static constexpr u64 chunk_size = 16 * MiB;
+    static constexpr u64 downloaded_size = 144 * MiB;
+    static constexpr u64 evicted_position = 100 * MiB;
+
+    auto stream = Media::IncrementallyPopulatedStream::create_empty();
+    stream->set_expected_size(stream_size);
+    stream->set_data_eviction_enabled(true);
+
+    auto chunk = make_test_data(chunk_size);
+    Vector<u64> requested_offsets;
+    bool pause_requested { false };
+
+    stream->set_data_request_callback([&](u64 offset) {
+        requested_offsets.append(offset);
+        stream->add_chunk_at(offset, chunk.bytes());
+    });
+    stream->set_pause_request_callback([&] {
+        pause_requested = true;
+    });
+
+    auto cursor = stream->create_cursor();
+    for (u64 offset = 0; offset < downloaded_size; offset += chunk_size)
+        stream->add_chunk_at(offset, chunk.bytes());
+
+    // The data far ahead of the cursor was dropped, and the download that delivered it should be paused.
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT(pause_requested);
+    EXPECT(requested_offsets.is_empty());
+
+    Array<u8, 16> buffer;
+    MUST(cursor->read_into(buffer));
+    for (size_t i = 0; i < buffer.size(); i++)
+        EXPECT_EQ(buffer[i], static_cast<u8>(i));
+
+    MUST(cursor->seek(evicted_position, SeekMode::SetPosition));
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> read_completed { false };
+    auto thread = Threading::Thread::construct("TestEviction"sv, [&, cursor]() -> intptr_t {
+        Array<u8, 16> buffer;
+        MUST(cursor->read_into(buffer));
+        for (size_t i = 0; i < buffer.size(); i++)
+            EXPECT_EQ(buffer[i], static_cast<u8>(i));
+        read_completed = true;
+        return 0;
+    });
+    thread->start();
+
+    auto start_time = MonotonicTime::now_coarse();
+    while (!read_completed) {
+        loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+        if (MonotonicTime::now_coarse() - start_time > AK::Duration::from_seconds(1))
+            break;
+    }
+    MUST(thread->join());
+
+    EXPECT(read_completed.load());
+    EXPECT_EQ(requested_offsets.size(), 1u);
+    EXPECT_EQ(requested_offsets.first(), evicted_position);
+}
+
+TEST_CASE(missing_data_behind_last_chunk_is_not_requested_without_eviction)
+{
+    Core::EventLoop loop;
+
+    auto stream = Media::IncrementallyPopulatedStream::create_empty();
+    stream->set_expected_size(200);
+
+    Vector<u64> requested_offsets;
+    stream->set_data_request_callback([&](u64 offset) {
+        requested_offsets.append(offset);
+    });
+
+    auto data = make_test_data(200);
+    stream->add_chunk_at(0, data.bytes().trim(100));
+    stream->add_chunk_at(150, data.bytes().slice(150));
+
+    auto cursor = stream->create_cursor();
+    Array<u8, 50> buffer;
+    MUST(cursor->read_into(buffer));
+
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT(requested_offsets.is_empty());
+}
@@ -21,7 +21,7 @@
 #include <LibTest/TestCase.h>
 
 template<typename T>
-static inline void decode_video(StringView path, size_t expected_frame_count, T create_decoder)
+static inline void decode_video(StringView path, size_t expected_frame_count, T create_decoder, Function<void(Media::VideoFrame const&)> on_decoded_frame = nullptr)
 {
     auto file = MUST(Core::File::open(path, Core::File::OpenMode::Read));
     auto stream = Media::IncrementallyPopulatedStream::create_from_buffer(MUST(file->read_until_eof()));
@@ -39,10 +39,29 @@ static inline void decode_video(StringView path, size_t expected_frame_count, T
 
     auto last_timestamp = AK::Duration::min();
 
+    auto receive_decoded_frames = [&] {
+        while (true) {
+            auto frame_result = decoder->get_decoded_frame({});
+            if (frame_result.is_error()) {
+                if (frame_result.error().category() == Media::DecoderErrorCategory::NeedsMoreInput || frame_result.error().category() == Media::DecoderErrorCategory::EndOfStream)
+                    break;
+                VERIFY_NOT_REACHED();
+            }
+            EXPECT(last_timestamp <= frame_result.value()->timestamp());
+            last_timestamp = frame_result.value()->timestamp();
+            if (on_decoded_frame)
+                on_decoded_frame(*frame_result.value());
+        }
+    };
+
     while (frame_count <= expected_frame_count) {
         auto block_result = iterator.next_block();
         if (block_result.is_error() && block_result.error().category() == Media::DecoderErrorCategory::EndOfStream) {
             VERIFY(frame_count == expected_frame_count);
+
+            // Threaded decoders may hold on to frames until they are told that no more input is coming.
+            decoder->signal_end_of_stream();
+            receive_decoded_frames();
             return;
         }
 
@@ -50,16 +69,7 @@ static inline void decode_video(StringView path, size_t expected_frame_count, T
         auto frames = MUST(iterator.get_frames(block));
         for (auto const& frame : frames) {
             MUST(decoder->receive_coded_data(block.timestamp(), block.duration().value_or(AK::Duration::zero()), frame));
-            while (true) {
-                auto frame_result = decoder->get_decoded_frame({});
-                if (frame_result.is_error()) {
-                    if (frame_result.error().category() == Media::DecoderErrorCategory::NeedsMoreInput)
-                        break;
-                    VERIFY_NOT_REACHED();
-                }
-                EXPECT(last_timestamp <= frame_result.value()->timestamp());
-                last_timestamp = frame_result.value()->timestamp();
-            }
+            receive_decoded_frames();
             frame_count++;
         }
     }
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibGfx/ImmutableBitmap.h>
 #include <LibMedia/FFmpeg/FFmpegVideoDecoder.h>
 
 #include "TestMediaCommon.h"
@@ -28,6 +29,16 @@ BENCHMARK_CASE(vp9_4k)
     decode_video("./vp9_4k.webm"sv, 2, make_decoder);
 }
 
+BENCHMARK_CASE(vp9_4k_with_cpu_conversion)
+{
+    decode_video("./vp9_4k.webm"sv, 2, make_decoder, [](Media::VideoFrame const& frame) {
+        auto bitmap = frame.immutable_bitmap();
+        EXPECT(bitmap->ensure_sk_image(nullptr));
+        EXPECT_EQ(bitmap->width(), static_cast<int>(frame.width()));
+        EXPECT_EQ(bitmap->height(), static_cast<int>(frame.height()));
+    });
+}
+
 BENCHMARK_CASE(vp9_clamp_reference_mvs)
 {
     decode_video("./vp9_clamp_reference_mvs.webm"sv, 92, make_decoder);
@@ -1875,3 +1875,60 @@ TEST_CASE(optimizer_simple_compare_char_class)
         EXPECT_EQ(re.match("abc"sv).success, false);
     }
 }
+
+TEST_CASE(pike_vm)
+{
+    // Nested quantifiers would backtrack exponentially; the Pike VM matches them in linear time.
+    {
+        Regex<ECMA262> re("^(a+)+b$");
+        EXPECT(re.parser_result.optimization_data.can_use_pike_vm);
+
+        EXPECT_EQ(re.match("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaac"sv).success, false);
+
+        auto result = re.match("aaab"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.capture_group_matches.first()[0].view.to_byte_string(), "aaa"sv);
+    }
+
+    // Alternatives keep their priority: the first alternative that leads to a match wins.
+    {
+        Regex<ECMA262> re("(?:(a|ab)(c|bcd))+(d*)");
+        EXPECT(re.parser_result.optimization_data.can_use_pike_vm);
+
+        auto result = re.match("abcd"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.capture_group_matches.first()[0].view.to_byte_string(), "a"sv);
+        EXPECT_EQ(result.capture_group_matches.first()[1].view.to_byte_string(), "bcd"sv);
+        EXPECT_EQ(result.capture_group_matches.first()[2].view.to_byte_string(), ""sv);
+    }
+
+    // Lazy quantifiers prefer the shortest match.
+    {
+        Regex<ECMA262> re("<((?:a|ab)+?)>");
+        EXPECT(re.parser_result.optimization_data.can_use_pike_vm);
+        auto result = re.search("<a><ab>"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), "<a>"sv);
+        EXPECT_EQ(result.capture_group_matches.first()[0].view.to_byte_string(), "a"sv);
+    }
+
+    // Backreferences, lookarounds and loops that can match the empty string need the backtracking matcher.
+    EXPECT(!Regex<ECMA262>("(a)\\1").parser_result.optimization_data.can_use_pike_vm);
+    EXPECT(!Regex<ECMA262>("a(?=b)").parser_result.optimization_data.can_use_pike_vm);
+    EXPECT(!Regex<ECMA262>("(a*)*b").parser_result.optimization_data.can_use_pike_vm);
+
+    // Patterns that can't backtrack catastrophically are left to the backtracking matcher.
+    EXPECT(!Regex<ECMA262>("a+b*c").parser_result.optimization_data.can_use_pike_vm);
+    EXPECT(!Regex<ECMA262>("(a|ab)(c|bcd)").parser_result.optimization_data.can_use_pike_vm);
+
+    // The thread lists are reused across start positions; a match further into the string must still be found.
+    {
+        Regex<ECMA262> re("(a+)+b", ECMAScriptFlags::Global);
+        EXPECT(re.parser_result.optimization_data.can_use_pike_vm);
+        auto result = re.match("aac ab aaab"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.count, 2u);
+        EXPECT_EQ(result.matches[0].view.to_byte_string(), "ab"sv);
+        EXPECT_EQ(result.matches[1].view.to_byte_string(), "aaab"sv);
+    }
+}
@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/String.h>
+#include <AK/StringBuilder.h>
 #include <AK/Vector.h>
 #include <LibTest/TestCase.h>
 #include <LibTextCodec/Decoder.h>
@@ -48,3 +50,103 @@ TEST_CASE(test_utf16le_decode)
     auto utf8 = MUST(decoder.to_utf8(test_string));
     EXPECT_EQ(utf8, "säk😀"sv);
 }
+
+TEST_CASE(test_single_byte_decode)
+{
+    auto& decoder = *TextCodec::decoder_for("windows-1252"sv);
+
+    // Long enough for ASCII runs to span several machine words, with non-ASCII bytes at word boundaries.
+    auto test_string = "Hello, world!\x80 caf\xe9 \x93quoted\x94 and a much longer run of plain ASCII text\x85"sv;
+    EXPECT_EQ(MUST(decoder.to_utf8(test_string)), "Hello, world!€ café “quoted” and a much longer run of plain ASCII text…"sv);
+
+    EXPECT_EQ(MUST(decoder.to_utf8("only ASCII in this one"sv)), "only ASCII in this one"sv);
+    EXPECT_EQ(MUST(decoder.to_utf8(""sv)), ""sv);
+
+    auto& x_user_defined_decoder = *TextCodec::decoder_for("x-user-defined"sv);
+    EXPECT_EQ(MUST(x_user_defined_decoder.to_utf8("abc\x80\xff"sv)), "abc\uF780\uF7FF"sv);
+
+    EXPECT_EQ(TextCodec::isomorphic_decode("na\xefve\xff"sv), "naïveÿ"sv);
+}
+
+TEST_CASE(test_ascii_run_decode)
+{
+    auto& decoder = *TextCodec::decoder_for("shift_jis"sv);
+
+    // ASCII runs are copied over in bulk, the rest goes through the decoder's state machine.
+    EXPECT_EQ(MUST(decoder.to_utf8("<!DOCTYPE html><title>\x93\xfa\x96\x7b</title>"sv)), "<!DOCTYPE html><title>日本</title>"sv);
+    EXPECT_EQ(MUST(decoder.to_utf8("<p>plain</p>"sv)), "<p>plain</p>"sv);
+
+    // ASCII bytes that are trail bytes of a character are not mistaken for the start of an ASCII run.
+    EXPECT_EQ(MUST(decoder.to_utf8("a\x81\x40" "b\x96\x7b{c"sv)), "a\u3000b本{c"sv);
+
+    // A trailing lead byte is still reported as an error.
+    EXPECT_EQ(MUST(decoder.to_utf8("abc\x93"sv)), "abc�"sv);
+
+    auto& gb18030_decoder = *TextCodec::decoder_for("gb18030"sv);
+
+    // Four-byte sequences have ASCII digits as their second and fourth byte.
+    EXPECT_EQ(MUST(gb18030_decoder.to_utf8("x\x81\x30\x81\x30yz"sv)), "x\u0080yz"sv);
+
+    // An ASCII byte that ends a sequence early is decoded again on its own, along with the digit before it.
+    EXPECT_EQ(MUST(gb18030_decoder.to_utf8("\x81\x30" "ab"sv)), "\uFFFD0ab"sv);
+}
+
+template<typename DecoderType>
+static void expect_same_result_as_process(StringView input)
+{
+    DecoderType decoder;
+
+    StringBuilder builder;
+    MUST(decoder.process(input, [&](u32 code_point) { return builder.try_append_code_point(code_point); }));
+
+    EXPECT_EQ(MUST(decoder.to_utf8(input)), builder.string_view());
+}
+
+TEST_CASE(test_ascii_runs_decode_like_process)
+{
+    static constexpr Array inputs {
+        "plain ASCII with a \x81\x40 lead and \x81 a lone lead"sv,
+        "\x81\x30\x81\x30\x81\x30" "ab\x81\x30\x81" "cd\x8e\xa1\x8f\xa2\xaf\x8fxy"sv,
+        "\xa4\x40\xa4\x41 big5 \x88\x62\x88\x64\x88zz\xfe"sv,
+        "\xb0\xa1 euc-kr \xb0\x41\x41\xb0"sv,
+        "ab\xff\xfe\x80\x7f\x00\x40\x40\x30\x30\x81"sv,
+    };
+
+    for (auto input : inputs) {
+        expect_same_result_as_process<TextCodec::GB18030Decoder>(input);
+        expect_same_result_as_process<TextCodec::Big5Decoder>(input);
+        expect_same_result_as_process<TextCodec::EUCJPDecoder>(input);
+        expect_same_result_as_process<TextCodec::ShiftJISDecoder>(input);
+        expect_same_result_as_process<TextCodec::EUCKRDecoder>(input);
+    }
+}
+
+// A document that is mostly markup, with short runs of Japanese text in between.
+static ByteString make_mostly_ascii_shift_jis_document()
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 20'000; ++i)
+        builder.append("<li><a href=\"/articles/12345\">\x93\xfa\x96\x7b\x8c\xea</a></li>\n"sv);
+    return builder.to_byte_string();
+}
+
+BENCHMARK_CASE(decode_mostly_ascii_shift_jis)
+{
+    auto document = make_mostly_ascii_shift_jis_document();
+    auto& decoder = *TextCodec::decoder_for("shift_jis"sv);
+
+    for (size_t i = 0; i < 10; ++i)
+        (void)MUST(decoder.to_utf8(document));
+}
+
+BENCHMARK_CASE(decode_mostly_ascii_windows_1252)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 20'000; ++i)
+        builder.append("<li><a href=\"/articles/12345\">caf\xe9 cr\xe8me</a></li>\n"sv);
+    auto document = builder.to_byte_string();
+    auto& decoder = *TextCodec::decoder_for("windows-1252"sv);
+
+    for (size_t i = 0; i < 10; ++i)
+        (void)MUST(decoder.to_utf8(document));
+}
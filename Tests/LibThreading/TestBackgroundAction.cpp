@@ -164,3 +164,43 @@ TEST_CASE(background_action_cancel_suppresses_on_error_and_on_complete)
     EXPECT_EQ(on_complete_count.load(AK::MemoryOrder::memory_order_relaxed), 0);
     EXPECT_EQ(on_error_count.load(AK::MemoryOrder::memory_order_relaxed), 0);
 }
+
+TEST_CASE(background_action_long_action_does_not_block_others)
+{
+    Core::EventLoop loop;
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> second_action_ran = false;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<int> on_complete_count = 0;
+
+    // The first action only finishes once the second one has run, which requires them to run on different threads.
+    auto first_action = Threading::BackgroundAction<int>::construct(
+        [&](auto& action) -> ErrorOr<int> {
+            while (!second_action_ran.load(AK::MemoryOrder::memory_order_relaxed) && !action.is_canceled())
+                MUST(Core::System::sleep_ms(1));
+            return 1;
+        },
+        [&](int) -> ErrorOr<void> {
+            on_complete_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+            return {};
+        });
+
+    auto second_action = Threading::BackgroundAction<int>::construct(
+        [&](auto&) -> ErrorOr<int> {
+            second_action_ran.store(true, AK::MemoryOrder::memory_order_relaxed);
+            return 2;
+        },
+        [&](int) -> ErrorOr<void> {
+            on_complete_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+            return {};
+        });
+
+    spin_until(loop, [&] {
+        return on_complete_count.load(AK::MemoryOrder::memory_order_relaxed) == 2;
+    });
+
+    if (!second_action_ran.load(AK::MemoryOrder::memory_order_relaxed))
+        first_action->cancel();
+
+    EXPECT(second_action_ran.load(AK::MemoryOrder::memory_order_relaxed));
+    (void)second_action;
+}
@@ -20,6 +20,7 @@ Description:
 
 Endpoints:
     - POST /echo <json body>, Creates an echo response for later use. See "Echo" class below for body properties.
+    - GET /echo/request-count/<path>, Returns the number of GET requests served by the echo response at /<path>.
 """
 
 
@@ -32,6 +33,7 @@ class Echo:
     delay_ms: Optional[int]
     reason_phrase: Optional[str]
     reflect_headers_in_body: bool
+    request_count: int
 
 
 # In-memory store for echo responses
@@ -67,6 +69,16 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
                             self._extra_headers.append((key.strip(), value.strip()))
 
             return super().do_GET()
+        elif self.path.startswith("/echo/request-count/"):
+            key = f"GET {self.path[len('/echo/request-count'):]}"
+            request_count = echo_store[key].request_count if key in echo_store else 0
+
+            self.send_response(200)
+            self.send_header("Access-Control-Allow-Origin", "*")
+            self.send_header("Cache-Control", "no-store")
+            self.send_header("Content-Type", "application/json")
+            self.end_headers()
+            self.wfile.write(json.dumps({"count": request_count}).encode("utf-8"))
         else:
             self.handle_echo()
 
@@ -85,6 +97,7 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
             echo.headers = data.get("headers", {})
             echo.reason_phrase = data.get("reason_phrase", None)
             echo.reflect_headers_in_body = data.get("reflect_headers_in_body", False)
+            echo.request_count = 0
 
             is_using_reserved_path = echo.path.startswith("/static") or echo.path.startswith("/echo")
 
@@ -163,6 +176,7 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
 
         if key in echo_store:
             echo = echo_store[key]
+            echo.request_count += 1
             response_headers = echo.headers.copy()
 
             if echo.delay_ms is not None:
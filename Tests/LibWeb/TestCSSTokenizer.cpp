@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/CSS/Parser/Tokenizer.h>
+
+namespace Web::CSS::Parser {
+
+static Vector<Token> tokenize(StringView input)
+{
+    return Tokenizer::tokenize(input, "utf-8"sv);
+}
+
+TEST_CASE(idents)
+{
+    auto tokens = tokenize("color: red"sv);
+    EXPECT_EQ(tokens.size(), 5u);
+    EXPECT_EQ(tokens[0].type(), Token::Type::Ident);
+    EXPECT_EQ(tokens[0].ident(), "color"sv);
+    EXPECT_EQ(tokens[1].type(), Token::Type::Colon);
+    EXPECT_EQ(tokens[2].type(), Token::Type::Whitespace);
+    EXPECT_EQ(tokens[3].type(), Token::Type::Ident);
+    EXPECT_EQ(tokens[3].ident(), "red"sv);
+    EXPECT_EQ(tokens[4].type(), Token::Type::EndOfFile);
+}
+
+TEST_CASE(idents_with_escapes_and_non_ascii_code_points)
+{
+    auto tokens = tokenize("a\\62 c café-x"sv);
+    EXPECT_EQ(tokens.size(), 4u);
+    EXPECT_EQ(tokens[0].ident(), "abc"sv);
+    EXPECT_EQ(tokens[0].original_source_text(), "a\\62 c"sv);
+    EXPECT_EQ(tokens[1].type(), Token::Type::Whitespace);
+    EXPECT_EQ(tokens[2].ident(), "café-x"sv);
+
+    tokens = tokenize("url(foo.png) calc("sv);
+    EXPECT_EQ(tokens[0].type(), Token::Type::Url);
+    EXPECT_EQ(tokens[0].url(), "foo.png"sv);
+    EXPECT_EQ(tokens[2].type(), Token::Type::Function);
+    EXPECT_EQ(tokens[2].function(), "calc"sv);
+}
+
+TEST_CASE(strings)
+{
+    auto tokens = tokenize("\"hello\" 'it\\'s' \"café\""sv);
+    EXPECT_EQ(tokens.size(), 6u);
+    EXPECT_EQ(tokens[0].type(), Token::Type::String);
+    EXPECT_EQ(tokens[0].string(), "hello"sv);
+    EXPECT_EQ(tokens[0].original_source_text(), "\"hello\""sv);
+    EXPECT_EQ(tokens[2].string(), "it's"sv);
+    EXPECT_EQ(tokens[4].string(), "café"sv);
+
+    tokens = tokenize("\"abc\ndef"sv);
+    EXPECT_EQ(tokens[0].type(), Token::Type::BadString);
+    EXPECT_EQ(tokens[1].type(), Token::Type::Whitespace);
+    EXPECT_EQ(tokens[2].ident(), "def"sv);
+
+    tokens = tokenize("'unterminated"sv);
+    EXPECT_EQ(tokens[0].type(), Token::Type::String);
+    EXPECT_EQ(tokens[0].string(), "unterminated"sv);
+}
+
+TEST_CASE(numbers)
+{
+    auto tokens = tokenize("+1.5e3px -12% 7 .5"sv);
+    EXPECT_EQ(tokens[0].type(), Token::Type::Dimension);
+    EXPECT_EQ(tokens[0].dimension_value(), 1500.0);
+    EXPECT_EQ(tokens[0].dimension_unit(), "px"sv);
+    EXPECT_EQ(tokens[0].original_source_text(), "+1.5e3px"sv);
+    EXPECT_EQ(tokens[2].type(), Token::Type::Percentage);
+    EXPECT_EQ(tokens[2].percentage(), -12.0);
+    EXPECT_EQ(tokens[4].type(), Token::Type::Number);
+    EXPECT_EQ(tokens[4].to_integer(), 7);
+    EXPECT_EQ(tokens[6].type(), Token::Type::Number);
+    EXPECT_EQ(tokens[6].number_value(), 0.5);
+}
+
+TEST_CASE(positions)
+{
+    auto tokens = tokenize("a\n \t\"é\" b"sv);
+    EXPECT_EQ(tokens.size(), 6u);
+
+    EXPECT_EQ(tokens[0].start_position().line, 0u);
+    EXPECT_EQ(tokens[0].start_position().column, 0u);
+    EXPECT_EQ(tokens[0].end_position().column, 1u);
+
+    EXPECT_EQ(tokens[1].type(), Token::Type::Whitespace);
+    EXPECT_EQ(tokens[1].end_position().line, 1u);
+    EXPECT_EQ(tokens[1].end_position().column, 2u);
+
+    // Columns count code points, not bytes.
+    EXPECT_EQ(tokens[2].type(), Token::Type::String);
+    EXPECT_EQ(tokens[2].start_position().column, 2u);
+    EXPECT_EQ(tokens[2].end_position().column, 5u);
+
+    EXPECT_EQ(tokens[4].ident(), "b"sv);
+    EXPECT_EQ(tokens[4].start_position().line, 1u);
+    EXPECT_EQ(tokens[4].start_position().column, 6u);
+}
+
+BENCHMARK_CASE(tokenize_stylesheet)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 2'000; ++i) {
+        builder.appendff(".item-{} > a:hover, #header .nav-link-{} {{\n", i, i);
+        builder.appendff("    margin: {}px 0 {}.5em auto;\n", i % 40, i % 7);
+        builder.append("    font-family: \"Helvetica Neue\", Arial, sans-serif;\n"sv);
+        builder.append("    background: url(images/background.png) no-repeat rgba(0, 0, 0, 0.25);\n"sv);
+        builder.append("    /* a comment */\n"sv);
+        builder.append("}\n"sv);
+    }
+    auto stylesheet = builder.string_view();
+
+    for (size_t i = 0; i < 20; ++i) {
+        auto tokens = tokenize(stylesheet);
+        EXPECT(tokens.size() > 50'000u);
+    }
+}
+
+}
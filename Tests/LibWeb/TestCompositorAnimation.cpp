@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/CompositorAnimation.h>
+
+namespace Web::Painting {
+
+static MonotonicTime const reference_time = MonotonicTime::now();
+
+static MonotonicTime at(i64 milliseconds)
+{
+    return reference_time + AK::Duration::from_milliseconds(milliseconds);
+}
+
+static NonnullRefPtr<CompositorAnimation> create_animation(CompositorAnimation::Timing timing, Vector<CompositorAnimation::Keyframe> keyframes, CompositorAnimation::Value underlying_value)
+{
+    timing.reference_time = reference_time;
+    auto target = AccumulatedVisualContext::create(1, EffectsData {}, nullptr);
+    return CompositorAnimation::create(target, move(timing), move(keyframes), move(underlying_value));
+}
+
+static NonnullRefPtr<CompositorAnimation> create_opacity_animation(CompositorAnimation::Timing timing)
+{
+    return create_animation(move(timing), { { 0.0, 0.0f }, { 1.0, 1.0f } }, 0.5f);
+}
+
+static float sample_opacity(CompositorAnimation const& animation, i64 milliseconds)
+{
+    return animation.sample(at(milliseconds)).get<float>();
+}
+
+TEST_CASE(progress_follows_the_timeline)
+{
+    // The animation started 250ms before the timeline time that was captured at the reference time.
+    auto animation = create_opacity_animation({ .timeline_time = 1250.0, .start_time = 1000.0, .iteration_duration = 1000.0 });
+
+    EXPECT_APPROXIMATE(animation->transformed_progress(at(0)).value(), 0.25);
+    EXPECT_APPROXIMATE(animation->transformed_progress(at(500)).value(), 0.75);
+    EXPECT_APPROXIMATE(sample_opacity(animation, 250), 0.5f);
+
+    // Without a fill mode, the animation has no effect once it's done and the underlying value shows through.
+    EXPECT(!animation->transformed_progress(at(750)).has_value());
+    EXPECT_APPROXIMATE(sample_opacity(animation, 750), 0.5f);
+}
+
+TEST_CASE(delay_fill_and_playback_rate)
+{
+    auto animation = create_opacity_animation({ .start_delay = 100.0, .iteration_duration = 200.0, .fill_mode = Bindings::FillMode::Both });
+    EXPECT_EQ(animation->transformed_progress(at(50)).value(), 0.0);
+    EXPECT_APPROXIMATE(animation->transformed_progress(at(150)).value(), 0.25);
+    EXPECT_EQ(animation->transformed_progress(at(400)).value(), 1.0);
+
+    animation = create_opacity_animation({ .playback_rate = 2.0, .iteration_duration = 1000.0 });
+    EXPECT_APPROXIMATE(animation->transformed_progress(at(100)).value(), 0.2);
+}
+
+TEST_CASE(iterations_and_direction)
+{
+    auto animation = create_opacity_animation({ .iteration_duration = 100.0, .iteration_count = 3.0, .playback_direction = Bindings::PlaybackDirection::Alternate });
+    EXPECT_APPROXIMATE(animation->transformed_progress(at(25)).value(), 0.25);
+    EXPECT_APPROXIMATE(animation->transformed_progress(at(125)).value(), 0.75);
+    EXPECT_APPROXIMATE(animation->transformed_progress(at(225)).value(), 0.25);
+
+    animation = create_opacity_animation({ .iteration_duration = 100.0, .iteration_count = AK::Infinity<double>, .playback_direction = Bindings::PlaybackDirection::Reverse });
+    EXPECT_APPROXIMATE(animation->transformed_progress(at(1030)).value(), 0.7);
+}
+
+TEST_CASE(keyframes)
+{
+    auto animation = create_animation({ .iteration_duration = 100.0 }, { { 0.0, 0.0f }, { 0.5, 1.0f }, { 1.0, 0.5f } }, 1.0f);
+    EXPECT_APPROXIMATE(sample_opacity(animation, 25), 0.5f);
+    EXPECT_APPROXIMATE(sample_opacity(animation, 50), 1.0f);
+    EXPECT_APPROXIMATE(sample_opacity(animation, 75), 0.75f);
+}
+
+TEST_CASE(keyframes_with_the_same_offset)
+{
+    auto animation = create_animation({ .iteration_duration = 100.0, .fill_mode = Bindings::FillMode::Forwards }, { { 0.0, 0.0f }, { 1.0, 1.0f }, { 1.0, 0.25f } }, 0.5f);
+    EXPECT_APPROXIMATE(sample_opacity(animation, 50), 0.5f);
+    EXPECT_APPROXIMATE(sample_opacity(animation, 150), 1.0f);
+}
+
+TEST_CASE(transform)
+{
+    CompositorAnimation::TransformFunctionList from { { CSS::TransformFunction::Translate, { 0.0f, 0.0f } } };
+    CompositorAnimation::TransformFunctionList to { { CSS::TransformFunction::Translate, { 100.0f, 50.0f } } };
+    auto animation = create_animation({ .iteration_duration = 100.0 }, { { 0.0, from }, { 1.0, to } }, CompositorAnimation::TransformFunctionList {});
+
+    auto matrix = animation->sample(at(25)).get<Gfx::FloatMatrix4x4>();
+    EXPECT_APPROXIMATE(matrix[0, 3], 25.0f);
+    EXPECT_APPROXIMATE(matrix[1, 3], 12.5f);
+    EXPECT_APPROXIMATE(matrix[0, 0], 1.0f);
+}
+
+}
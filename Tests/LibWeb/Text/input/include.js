@@ -119,6 +119,13 @@ class HTTPTestServer {
         }
         return `${this.baseURL}${path}`;
     }
+    async getRequestCount(path) {
+        const result = await fetch(`${this.baseURL}/echo/request-count${path}`, { cache: "no-store" });
+        if (!result.ok) {
+            throw new Error("Error getting request count: " + result.statusText);
+        }
+        return (await result.json()).count;
+    }
     getStaticURL(path) {
         return `${this.baseURL}/static/${path}`;
     }
@@ -16,6 +16,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/TypeFeedback.h>
 #include <LibJS/Console.h>
 #include <LibJS/Contrib/Test262/GlobalObject.h>
 #include <LibJS/Parser.h>
@@ -24,6 +25,7 @@
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/JSONObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibJS/SourceTextModule.h>
@@ -58,6 +60,8 @@ private:
     JS_DECLARE_NATIVE_FUNCTION(exit_interpreter);
     JS_DECLARE_NATIVE_FUNCTION(repl_help);
     JS_DECLARE_NATIVE_FUNCTION(save_to_file);
+    JS_DECLARE_NATIVE_FUNCTION(start_profiler);
+    JS_DECLARE_NATIVE_FUNCTION(stop_profiler);
     JS_DECLARE_NATIVE_FUNCTION(load_ini);
     JS_DECLARE_NATIVE_FUNCTION(load_json);
     JS_DECLARE_NATIVE_FUNCTION(last_value_getter);
@@ -188,6 +192,14 @@ static ErrorOr<void> write_to_file(String const& path)
     return {};
 }
 
+static ErrorOr<void> write_cpu_profile(StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write, 0666));
+    auto profile = g_vm->sampling_profiler().to_cpuprofile().serialized();
+    TRY(file->write_until_depleted(profile.bytes()));
+    return {};
+}
+
 static ErrorOr<bool> parse_and_run(JS::Realm& realm, StringView source, StringView source_name, bool parse_only = false)
 {
     auto& vm = realm.vm();
@@ -310,6 +322,8 @@ void ReplObject::initialize(JS::Realm& realm)
     define_native_function(realm, "exit"_utf16_fly_string, exit_interpreter, 0, attr);
     define_native_function(realm, "help"_utf16_fly_string, repl_help, 0, attr);
     define_native_function(realm, "save"_utf16_fly_string, save_to_file, 1, attr);
+    define_native_function(realm, "startProfiler"_utf16_fly_string, start_profiler, 0, attr);
+    define_native_function(realm, "stopProfiler"_utf16_fly_string, stop_profiler, 1, attr);
     define_native_function(realm, "loadINI"_utf16_fly_string, load_ini, 1, attr);
     define_native_function(realm, "loadJSON"_utf16_fly_string, load_json, 1, attr);
     define_native_function(realm, "print"_utf16_fly_string, print, 1, attr);
@@ -346,6 +360,26 @@ JS_DEFINE_NATIVE_FUNCTION(ReplObject::save_to_file)
     return JS::Value(false);
 }
 
+JS_DEFINE_NATIVE_FUNCTION(ReplObject::start_profiler)
+{
+    auto sampling_interval = JS::SamplingProfiler::default_sampling_interval;
+    if (vm.argument_count())
+        sampling_interval = AK::Duration::from_milliseconds(TRY(vm.argument(0).to_u32(vm)));
+    vm.sampling_profiler().start(sampling_interval);
+    return JS::js_undefined();
+}
+
+JS_DEFINE_NATIVE_FUNCTION(ReplObject::stop_profiler)
+{
+    vm.sampling_profiler().stop();
+    if (!vm.argument_count())
+        return JS::Value(false);
+    auto const profile_path = TRY(vm.argument(0).to_string(vm));
+    if (!write_cpu_profile(profile_path).is_error())
+        return JS::Value(true);
+    return JS::Value(false);
+}
+
 JS_DEFINE_NATIVE_FUNCTION(ReplObject::exit_interpreter)
 {
     if (vm.argument_count() != 0)
@@ -364,6 +398,8 @@ JS_DEFINE_NATIVE_FUNCTION(ReplObject::repl_help)
     warnln("    loadJSON(file): load the given file as JSON.");
     warnln("    print(value): pretty-print the given JS value.");
     warnln("    save(file): write REPL input history to the given file. For example: save(\"foo.txt\")");
+    warnln("    startProfiler(interval): start sampling the JS call stack every `interval` milliseconds. Defaults to 1.");
+    warnln("    stopProfiler(file): stop the profiler and write a .cpuprofile to the given file.");
     return JS::js_undefined();
 }
 
@@ -824,6 +860,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool use_test262_global = false;
     bool parse_only = false;
     StringView evaluate_script;
+    StringView cpu_profile_path;
+    u32 cpu_profile_interval_in_milliseconds = 1;
     Vector<StringView> script_paths;
 
     Core::ArgsParser args_parser;
@@ -831,6 +869,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(parse_only, "Parse only", "parse-only", 'p');
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(JS::Bytecode::g_optimize_bytecode, "Run register optimizations on the generated bytecode", "optimize-bytecode", {});
+    args_parser.add_option(JS::Bytecode::g_collect_type_feedback, "Collect type feedback and report the hottest functions on exit", "type-feedback", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -840,6 +880,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(disable_syntax_highlight, "Disable live syntax highlighting", "no-syntax-highlight", 's');
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
+    args_parser.add_option(cpu_profile_path, "Sample the JS call stack and write a .cpuprofile to the given path", "cpu-profile", {}, "path");
+    args_parser.add_option(cpu_profile_interval_in_milliseconds, "Sampling interval for --cpu-profile in milliseconds", "cpu-profile-interval", {}, "ms");
     args_parser.add_option(use_test262_global, "Use test262 global ($262)", "use-test262-global", {});
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
@@ -925,7 +967,21 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only)))
+        if (!cpu_profile_path.is_empty())
+            g_vm->sampling_profiler().start(AK::Duration::from_milliseconds(cpu_profile_interval_in_milliseconds));
+
+        auto succeeded = TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only));
+
+        if (!cpu_profile_path.is_empty()) {
+            g_vm->sampling_profiler().stop();
+            if (auto result = write_cpu_profile(cpu_profile_path); result.is_error())
+                warnln("Failed to write CPU profile to '{}': {}", cpu_profile_path, result.error());
+        }
+
+        if (JS::Bytecode::g_collect_type_feedback)
+            JS::Bytecode::dump_type_feedback(10);
+
+        if (!succeeded)
             return 1;
     }
 